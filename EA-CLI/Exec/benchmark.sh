@@ -0,0 +1,144 @@
+#!/bin/bash
+# End-to-end benchmark of the shipped configurations.
+# Every configuration is run for a fixed evaluation budget at each thread count (and on local cluster ranks),
+# the BenchmarkHook summaries (-m option) are collected into results.json and a scaling table is printed.
+
+function usage {
+	echo "Usage: openea benchmark [options]"
+	echo "Options:"
+	echo "    -e <evals>     Evaluation budget of each run (default: 200000)"
+	echo "    -t \"<list>\"    Thread counts (default: 1 2 4 ... up to the number of cores)"
+	echo "    -c \"<list>\"    Numbers of local cluster ranks (default: none, e.g. \"2 4\")"
+	echo "    -f <filter>    Only run the configurations whose name contains <filter>"
+	echo "    -q             Skip the synthetic large variants"
+	echo "    -o <dir>       Output directory (default: benchmark-<date>)"
+	exit 1
+}
+
+clidir=$(dirname $(realpath "$0"))
+resdir=$clidir/../resources
+export LD_LIBRARY_PATH=$LD_LIBRARY_PATH:$clidir/../../EA/SharedLib:/usr/local/lib
+
+budget=200000
+threads=""
+ranks=""
+filter=""
+synthetic=1
+outdir=benchmark-$(date +%Y%m%d-%H%M%S)
+
+while getopts "e:t:c:f:qo:h" opt; do
+	case $opt in
+		e) budget=$OPTARG ;;
+		t) threads=$OPTARG ;;
+		c) ranks=$OPTARG ;;
+		f) filter=$OPTARG ;;
+		q) synthetic=0 ;;
+		o) outdir=$OPTARG ;;
+		*) usage ;;
+	esac
+done
+
+if [[ -z $threads ]]; then
+	cores=$(nproc)
+	for (( t = 1; t < cores; t *= 2 )); do
+		threads="$threads $t"
+	done
+	threads="$threads $cores"
+fi
+
+# <name> <file> <variables...>
+configs=(
+	"OneMax OneMax.eaml"
+	"TenMax TenMax.eaml"
+	"EightQueens EightQueens.eaml"
+	"Rosenbrock Rosenbrock.eaml"
+	"H1Benchmark H1Benchmark.eaml"
+)
+if [[ $synthetic == 1 ]]; then
+	configs+=(
+		"OneMax-Large OneMax.eaml --size=2000"
+		"TenMax-Large TenMax.eaml --size=1000 --length=1000 --bound=100"
+		"EightQueens-Large EightQueens.eaml --size=1000 --length=512"
+		"Rosenbrock-Large Rosenbrock.eaml --dim=200 --lambda=400 --mu=200"
+	)
+fi
+
+mkdir -p "$outdir/runs" "$outdir/logs" "$outdir/backup" || exit 1
+outdir=$(realpath "$outdir")
+
+completed=()
+
+# Run one configuration: run <id> <config> <launcher> <options...>
+function run {
+	local id=$1 config=($2) launcher=($3)
+	shift 3
+	local name=${config[0]} file=$resdir/${config[1]}
+
+	echo "Running $id..."
+	"${launcher[@]}" "$clidir/openea-run" "$file" "$@" "${config[@]:2}" -te$budget -m$name=$outdir/runs/$id.json -b0=$outdir/backup/$id \
+			-li= -lt= > "$outdir/logs/$id.log" 2>&1
+	if [[ $? != 0 || ! -s $outdir/runs/$id.json ]]; then
+		echo "    failed, see $outdir/logs/$id.log"
+		rm -f "$outdir/runs/$id.json"
+	else
+		completed+=("$outdir/runs/$id.json")
+	fi
+}
+
+for config in "${configs[@]}"; do
+	name=${config%% *}
+	if [[ -n $filter && $name != *$filter* ]]; then
+		continue
+	fi
+
+	for t in $threads; do
+		run "$name-t$t" "$config" "" -p$t
+	done
+	for r in $ranks; do
+		run "$name-r$r" "$config" "mpirun -quiet --oversubscribe -np $r" -c
+	done
+done
+
+# Collect the summaries
+{
+	echo "["
+	first=1
+	for file in "${completed[@]}"; do
+		[[ $first == 1 ]] || echo ","
+		first=0
+		cat "$file"
+	done
+	echo "]"
+} > "$outdir/results.json"
+
+# Scaling table: the speedup of each run is relative to the same configuration at 1 thread.
+# The efficiency is the speedup per worker (threads, or slave ranks in cluster mode)
+function field {
+	sed -n "s/.*\"$2\":\"\{0,1\}\([^,\"]*\).*/\1/p" "$1"
+}
+
+{
+	echo "config,threads,ranks,generations,evaluations,seconds,gens_per_sec,evals_per_sec,peak_rss_kb"
+	for file in "${completed[@]}"; do
+		echo "$(field $file label),$(field $file threads),$(field $file ranks),$(field $file generations),$(field $file evaluations),$(field $file seconds),$(field $file gens_per_sec),$(field $file evals_per_sec),$(field $file peak_rss_kb)"
+	done
+} > "$outdir/results.csv"
+
+echo
+awk -F, 'NR > 1 {
+		rows[NR] = $0
+		if ($2 == 1 && $3 == 1)
+			base[$1] = $8
+	}
+	END {
+		printf "%-20s %7s %5s %12s %12s %10s %8s %10s\n", "config", "threads", "ranks", "gens/s", "evals/s", "rss(MiB)", "speedup", "efficiency"
+		for (i = 2; i <= NR; i++) {
+			split(rows[i], f, ",")
+			workers = (f[3] > 1 ? f[3] - 1 : f[2])
+			speedup = (base[f[1]] > 0 ? f[8] / base[f[1]] : 0)
+			printf "%-20s %7d %5d %12.1f %12.1f %10.1f %8.2f %9.0f%%\n", f[1], f[2], f[3], f[7], f[8], f[9] / 1024, speedup, speedup / workers * 100
+		}
+	}' "$outdir/results.csv" | tee "$outdir/scaling.txt"
+
+echo
+echo "Results written to $outdir (results.json, results.csv, scaling.txt)"
@@ -0,0 +1,38 @@
+/*
+ * BenchmarkReport.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include <pch.h>
+#include "CLIOptions.h"
+
+namespace ea {
+namespace cli {
+
+using namespace std;
+
+function<void(void)> BenchmarkReport(istringstream& iss) {
+	string token, label;
+
+	if (!getline(iss, token, '='))
+		THROW;
+
+	if (!iss.eof()) {
+		label = token;
+		if (!getline(iss, token))
+			THROW;
+	}
+
+	return [token, label] () {
+		CommandLineInterface::Register([token, label] (StrategyPtr& strategy) {
+			BenchmarkHookPtr hook = make_shared<BenchmarkHook>(token);
+			hook->SetLabel(label);
+			strategy->hooks.Add(hook);
+		});
+	};
+}
+
+}
+}
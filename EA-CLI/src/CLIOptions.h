@@ -31,6 +31,9 @@ function<void(void)> Restore(istringstream& iss);
 function<void(void)> Parallel(istringstream& iss);
 function<void(void)> Server(istringstream& iss);
 function<void(void)> FitnessReport(istringstream& iss);
+function<void(void)> BenchmarkReport(istringstream& iss);
+function<void(void)> Overhead(istringstream& iss);
+function<void(void)> MemoryReport(istringstream& iss);
 function<void(void)> Repeat(istringstream& iss);
 
 }
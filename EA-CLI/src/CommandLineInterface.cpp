@@ -267,6 +267,10 @@ void PrintHelp() {
 			"\n"
 			"\t-b[<num>=]<dir>\t\tBack-up to <dir> every <num> generations (default is <num>=0)\n"
 			"\t\t" BOLD(Note) ": if not specified in <options> or <config file>, -b0=\".backup\" will be added by default\n"
+			"\t-f[<num>=]<file>\tReport fitness values to <file> every <num> generations (binary if <file> ends with .eafh)\n"
+			"\t-m[<label>=]<file>\tWrite throughput, phase times and peak memory of the run to <file> (JSON)\n"
+			"\t-z[<seed>]\t\tReplace the evaluator by NullEvaluator and report the framework overhead per generation\n"
+			"\t-a[<num>]\t\tLog live objects and memory usage every <num> generations (default is 1)\n"
 			"\t-r[[<num>=]<dir>]\tRestore from <dir> from generation <num> (default is <num>=max, <dir>=\".backup\")\n"
 			"\t\t" BOLD(Note) ": -r implies -b0=<dir> option on the same <dir> of -r unless otherwise specified\n\n"
 			"\t--<key>=<value>\t\tSet variable named <key> in <config file> with <value>\n\n";
@@ -298,6 +302,12 @@ function<void(void)> ProcessOption(const char* option) {
 		return Restore(iss);
 	case 'f':
 		return FitnessReport(iss);
+	case 'm':
+		return BenchmarkReport(iss);
+	case 'z':
+		return Overhead(iss);
+	case 'a':
+		return MemoryReport(iss);
 	case 'p':
 		return Parallel(iss);
 	case 's':
@@ -36,7 +36,9 @@ function<void(void)> FitnessReport(istringstream& iss) {
 	}
 
 	return [token, gen] () {
-		HookPtr hook = make_shared_base(Hook, FitnessReportHook, token, gen, true);
+		FitnessReportHookPtr hook = make_shared<FitnessReportHook>(token, gen, true);
+		if (boost::filesystem::path(token).extension() == ".eafh")
+			hook->SetFormat(FitnessReportHook::FORMAT_BINARY);
 		CommandLineInterface::Register([hook] (StrategyPtr& strategy) {
 			strategy->hooks.Add(hook);
 		});
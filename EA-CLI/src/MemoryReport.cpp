@@ -0,0 +1,29 @@
+/*
+ * MemoryReport.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include <pch.h>
+#include "CLIOptions.h"
+
+namespace ea {
+namespace cli {
+
+using namespace std;
+
+function<void(void)> MemoryReport(istringstream& iss) {
+	ullong frequency = iss.peek() == EOF ? 1 : ExtractNumber(iss, "<num>");
+
+	return [frequency] () {
+		// Count the objects created while loading the strategy too
+		ObjectCounter::SetEnabled(true);
+		CommandLineInterface::Register([frequency] (StrategyPtr& strategy) {
+			strategy->hooks.Create<MemoryReportHook>(frequency);
+		});
+	};
+}
+
+}
+}
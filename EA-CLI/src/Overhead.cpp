@@ -0,0 +1,89 @@
+/*
+ * Overhead.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include <pch.h>
+#include "CLIOptions.h"
+#include <EA/Strategy.h>
+#include <chrono>
+
+namespace ea {
+namespace cli {
+
+using namespace std;
+
+// Reports the time per generation of each phase when the evolution ends
+class OverheadReportHook : public Hook {
+public:
+	EA_TYPEINFO_DEFAULT(OverheadReportHook)
+
+protected:
+	virtual void DoStart() override {
+		mStartGen = GetGeneration();
+		mStartEval = GetEvaluation();
+		mStartTime = chrono::steady_clock::now();
+	}
+
+	virtual void DoEnd() override {
+		double wall = chrono::duration<double, milli>(chrono::steady_clock::now() - mStartTime).count();
+		ullong generations = GetGeneration() - mStartGen;
+		ullong evaluations = GetEvaluation() - mStartEval;
+		if (generations == 0)
+			return;
+
+		auto& session = GetSession();
+		auto records = session->GetTimeRecords(session->GetStrategy()->GetTimeRecordOrder());
+		double other = wall;
+		for (auto& record : records)
+			other -= record.total;
+		auto share = [wall] (double pTime) { return wall > 0 ? pTime / wall * 100 : 0; };
+
+		LogStream stream(Log::INFO);
+		stream << fixed << setprecision(4) << "Framework Overhead (NullEvaluator, ms per generation):";
+		for (auto& record : records)
+			stream << " [" << record.id << "] " << record.total / generations
+					<< " (" << setprecision(1) << share(record.total) << "%)" << setprecision(4);
+		// Hooks and the untracked parts of the loop
+		stream << " [Other] " << other / generations
+				<< " (" << setprecision(1) << share(other) << "%)" << setprecision(4)
+				<< " [Generation] " << wall / generations << "\n"
+				<< setprecision(1) << "Throughput floor: " << generations / wall * 1000 << " generations/s, "
+				<< evaluations / wall * 1000 << " evaluations/s" << flush;
+	}
+
+private:
+	ullong mStartGen = 0;
+	ullong mStartEval = 0;
+	chrono::steady_clock::time_point mStartTime;
+};
+
+function<void(void)> Overhead(istringstream& iss) {
+	ullong seed = iss.peek() == EOF ? 0 : ExtractNumber(iss, "<seed>");
+
+	return [seed] () {
+		CommandLineInterface::Register([seed] (StrategyPtr& strategy) {
+			// Keep the optimization direction of the replaced evaluator
+			auto replace = [seed] (Operator<IndividualEvaluator>& pEvaluator) {
+				auto scalar = dynamic_pointer_cast<ScalarEvaluator>(pEvaluator.Get());
+				pEvaluator.Create<NullEvaluator>(scalar ? scalar->IsMaximizer() : true, seed);
+			};
+
+			if (auto es = dynamic_pointer_cast<EvolutionStrategy>(strategy))
+				replace(es->evaluator);
+			else if (auto cmaes = dynamic_pointer_cast<CMAEvolutionStrategy>(strategy))
+				replace(cmaes->evaluator);
+			else
+				throw EA_EXCEPTION(EAException, OTHERS,
+						"CLI: -z option is not supported by \"" + strategy->GetTypeName() + "\".");
+
+			strategy->hooks.Create<OverheadReportHook>();
+			EA_LOG_DEBUG << "CLI: Evaluator replaced by NullEvaluator because of -z option." << flush;
+		});
+	};
+}
+
+}
+}
@@ -11,6 +11,7 @@
 #include "EA/Array.h"
 #include "EA/Core.h"
 #include "EA/Permutation.h"
+#include "EA/Problem.h"
 #include "EA/Selector.h"
 #include "EA/Utility.h"
 #include "EA/Strategy.h"
@@ -13,6 +13,7 @@
 #include "../core/Organism.h"
 #include "../core/Population.h"
 #include "../core/Session.h"
+#include "../core/Phase.h"
 
 #include "../core/Operator.h"
 #include "../core/OperatorGroup.h"
@@ -28,8 +29,10 @@
 #include "../core/interface/Hook.h"
 #include "../core/interface/Fitness.h"
 #include "../core/interface/Strategy.h"
+#include "../core/interface/Checkpointable.h"
 
 #include "../core/pool/GenomePool.h"
 #include "../core/pool/OrganismPool.h"
 #include "../core/pool/MetaPool.h"
+#include "../core/pool/CheckpointPool.h"
 #include "../core/pool/Pool.h"
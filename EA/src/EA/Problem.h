@@ -0,0 +1,23 @@
+/*
+ * Problem.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "Type/Problem.h"
+
+#include "../problem/continuous/ContinuousFunction.h"
+#include "../problem/continuous/SphereFunction.h"
+#include "../problem/continuous/EllipsoidFunction.h"
+#include "../problem/continuous/RastriginFunction.h"
+#include "../problem/continuous/RosenbrockFunction.h"
+#include "../problem/continuous/AckleyFunction.h"
+
+#include "../problem/array/OneMaxFunction.h"
+#include "../problem/array/LeadingOnesFunction.h"
+#include "../problem/array/NKLandscapeFunction.h"
+
+#include "../problem/permutation/TSPFunction.h"
@@ -25,6 +25,8 @@ DEFINE_PTR_TYPE(Pool)
 DEFINE_PTR_TYPE(GenomePool)
 DEFINE_PTR_TYPE(OrganismPool)
 DEFINE_PTR_TYPE(MetaPool)
+DEFINE_PTR_TYPE(CheckpointPool)
+DEFINE_PTR_TYPE(Checkpointable)
 DEFINE_PTR_TYPE(Hook)
 DEFINE_PTR_TYPE(Fitness)
 DEFINE_PTR_TYPE(Strategy)
@@ -0,0 +1,28 @@
+/*
+ * Problem.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../../Common.h"
+#include "Core.h"
+
+namespace ea {
+
+DEFINE_PTR_TYPE(ContinuousFunction)
+DEFINE_PTR_TYPE(SphereFunction)
+DEFINE_PTR_TYPE(EllipsoidFunction)
+DEFINE_PTR_TYPE(RastriginFunction)
+DEFINE_PTR_TYPE(RosenbrockFunction)
+DEFINE_PTR_TYPE(AckleyFunction)
+
+DEFINE_PTR_TYPE(OneMaxFunction)
+DEFINE_PTR_TYPE(LeadingOnesFunction)
+DEFINE_PTR_TYPE(NKLandscapeFunction)
+
+DEFINE_PTR_TYPE(TSPFunction)
+
+}
@@ -27,7 +27,9 @@ DEFINE_PTR_TYPE(TypeInfo)
 DEFINE_PTR_TYPE_WITH_TEMPLATE(Randomizer)
 DEFINE_PTR_TYPE_TEMPLATE_PACK(Randomizer)
 
+DEFINE_PTR_TYPE(ScalarEvaluator)
 DEFINE_PTR_TYPE(FunctionalEvaluator)
+DEFINE_PTR_TYPE(NullEvaluator)
 DEFINE_PTR_TYPE_WITH_TEMPLATE(TypedScalarEvaluator)
 DEFINE_PTR_TYPE_WITH_TEMPLATE(TypedFunctionalEvaluator)
 
@@ -38,8 +40,12 @@ DEFINE_PTR_TYPE(FitnessTerminationHook);
 DEFINE_PTR_TYPE(GenerationTerminationHook);
 DEFINE_PTR_TYPE(EvaluationTerminationHook);
 DEFINE_PTR_TYPE(BackupHook);
+DEFINE_PTR_TYPE(BackupCodec);
 DEFINE_PTR_TYPE(RealTimeInfoHook);
 DEFINE_PTR_TYPE(FitnessReportHook);
+DEFINE_PTR_TYPE(TraceHook);
+DEFINE_PTR_TYPE(BenchmarkHook);
+DEFINE_PTR_TYPE(MemoryReportHook);
 
 DEFINE_PTR_TYPE_WITH_TEMPLATE(TypedRecombinator)
 
@@ -13,6 +13,9 @@
 #include "../utility/MetaMutator.h"
 #include "../utility/MetaRecombinator.h"
 #include "../utility/Restore.h"
+#include "../utility/BackupReader.h"
+#include "../utility/FitnessHistoryReader.h"
+#include "../utility/Checkpoint.h"
 
 #include "../rtoc/Constructible.h"
 #include "../rtoc/EAMLReader.h"
@@ -21,13 +24,20 @@
 #include "../rtoc/Storable.h"
 #include "../rtoc/BinarySerializer.h"
 #include "../rtoc/TypeInfo.h"
+#include "../rtoc/TypeDictionary.h"
 #include "../rtoc/UnifiedData.h"
 
 #include "../misc/Randomizer.h"
 #include "../misc/Random.h"
+#include "../misc/BitWords.h"
 #include "../misc/Log.h"
+#include "../misc/Tracer.h"
+#include "../misc/PerfCounters.h"
+#include "../misc/ObjectCounter.h"
+#include "../misc/TimeHistogram.h"
 #include "../misc/Cluster.h"
 #include "../evaluator/FunctionalEvaluator.h"
+#include "../evaluator/NullEvaluator.h"
 #include "../evaluator/ScalarEvaluator.h"
 #include "../evaluator/TypedScalarEvaluator.h"
 
@@ -38,8 +48,12 @@
 #include "../hook/termination/GenerationTerminationHook.h"
 #include "../hook/termination/EvaluationTerminationHook.h"
 #include "../hook/BackupHook.h"
+#include "../hook/BackupCodec.h"
 #include "../hook/realtimeinfo/RealTimeInfoHook.h"
 #include "../hook/FitnessReportHook.h"
+#include "../hook/TraceHook.h"
+#include "../hook/BenchmarkHook.h"
+#include "../hook/MemoryReportHook.h"
 
 #include "../mutator/TypedMutator.h"
 #include "../recombinator/TypedRecombinator.h"
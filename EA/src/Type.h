@@ -15,4 +15,5 @@
 #include "EA/Type/Selector.h"
 #include "EA/Type/Array.h"
 #include "EA/Type/Permutation.h"
+#include "EA/Type/Problem.h"
 #include "EA/Type/Strategy.h"
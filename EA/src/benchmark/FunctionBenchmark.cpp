@@ -0,0 +1,474 @@
+/*
+ * FunctionBenchmark.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../pch.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <chrono>
+#include "../EA.h"
+
+using namespace ea;
+using namespace std;
+
+/*
+ * Black-box benchmark of the strategies on the built-in problems.
+ *
+ * Every strategy is run several times on every problem it supports, until the target fitness is reached or the
+ * evaluation budget is exhausted. Each run reports the evaluations needed to reach the target, the number of
+ * generations, the wall time and the best fitness. The summary of each pair reports the success rate,
+ * the median evaluations to target of the successful runs and the expected running time
+ * (ERT = evaluations of all runs / successful runs).
+ * The problems without a known optimum (NK-landscape, TSP) have no target and always use the whole budget.
+ *
+ * The problem instances (shift, rotation, NK table, cities) are generated from the seed and are the same for all
+ * the runs, run i of a strategy is seeded with seed + i.
+ *
+ * Usage: FunctionBenchmark [options]
+ *   --problems N1,N2,...   Only run the problems whose name contains one of the given strings.
+ *   --strategies N1,N2,... Only run the strategies whose name contains one of the given strings.
+ *   --dimension D          Dimension of the continuous problems (default: 10).
+ *   --length L             Length of the bit-string problems (default: 100).
+ *   --cities C             Number of cities of the TSP (default: 50).
+ *   --runs R               Number of runs of each pair (default: 5).
+ *   --budget E             Evaluation budget of each run (default: 100000).
+ *   --threads T            Number of threads (default: 1).
+ *   --format csv|json      Output format (default: csv).
+ *   --output FILE          Write the results to a file instead of stdout.
+ *   --label LABEL          A label added to each result (e.g. the build name) to compare results.
+ *   --seed SEED            The random seed (default: 1).
+ */
+
+enum ProblemKind {
+	CONTINUOUS, BIT_STRING, PERMUTATION
+};
+
+struct Problem {
+	string name;
+	ProblemKind kind;
+	// Create the evaluator of the instance with the given seed
+	function<ScalarEvaluatorPtr(ullong)> create;
+	// NaN if the optimum is not known
+	double target;
+};
+
+struct BenchmarkStrategy {
+	string name;
+	vector<ProblemKind> kinds;
+	// Create the strategy for the given problem size
+	function<StrategyPtr(ProblemKind, uint, const ScalarEvaluatorPtr&)> create;
+};
+
+struct RunResult {
+	string problem;
+	string strategy;
+	uint size;
+	uint run;
+	bool success;
+	ullong evalsToTarget;
+	ullong evaluations;
+	ullong generations;
+	double seconds;
+	double best;
+};
+
+struct BenchmarkOptions {
+	vector<string> problems;
+	vector<string> strategies;
+	uint dimension = 10;
+	uint length = 100;
+	uint cities = 50;
+	uint runs = 5;
+	ullong budget = 100000;
+	uint threads = 1;
+	string format = "csv";
+	string output;
+	string label;
+	llong seed = 1;
+};
+
+// Terminates the run when the target is reached or the budget is exhausted
+class TargetHook : public Hook {
+public:
+	EA_TYPEINFO_CUSTOM_INLINE {
+		return ea::TypeInfo("TargetHook");
+	}
+	EA_TYPEINFO_GET
+
+	TargetHook(double pTarget, bool pMaximizer, ullong pBudget) :
+			target(pTarget), maximizer(pMaximizer), budget(pBudget), success(false), evalsToTarget(0), best(0) {
+	}
+
+	double target;
+	bool maximizer;
+	ullong budget;
+
+	bool success;
+	ullong evalsToTarget;
+	double best;
+
+protected:
+	virtual void DoStart() override {
+		Check();
+	}
+
+	virtual void DoGenerational() override {
+		Check();
+	}
+
+private:
+	void Check() {
+		// The main pool of CMAEvolutionStrategy is empty before the first generation
+		if (GetMainPool()->empty())
+			return;
+		best = GetBestOrganism()->GetFitnessValue();
+		if (!std::isnan(target) && (maximizer ? best >= target : best <= target)) {
+			success = true;
+			evalsToTarget = GetEvaluation();
+			Terminate();
+		} else if (GetEvaluation() >= budget)
+			Terminate();
+	}
+};
+
+static vector<string> Split(const string& pList) {
+	vector<string> result;
+	istringstream iss(pList);
+	string item;
+	while (getline(iss, item, ','))
+		if (!item.empty())
+			result.push_back(item);
+	return result;
+}
+
+static BenchmarkOptions ParseOptions(int argc, char** argv) {
+	BenchmarkOptions options;
+
+	for (int i = 1; i < argc; i++) {
+		string option = argv[i];
+		if (i + 1 >= argc)
+			throw invalid_argument("Missing value of option " + option);
+		string value = argv[++i];
+
+		if (option == "--problems")
+			options.problems = Split(value);
+		else if (option == "--strategies")
+			options.strategies = Split(value);
+		else if (option == "--dimension")
+			options.dimension = stoul(value);
+		else if (option == "--length")
+			options.length = stoul(value);
+		else if (option == "--cities")
+			options.cities = stoul(value);
+		else if (option == "--runs")
+			options.runs = stoul(value);
+		else if (option == "--budget")
+			options.budget = stoull(value);
+		else if (option == "--threads")
+			options.threads = stoul(value);
+		else if (option == "--format")
+			options.format = value;
+		else if (option == "--output")
+			options.output = value;
+		else if (option == "--label")
+			options.label = value;
+		else if (option == "--seed")
+			options.seed = stoll(value);
+		else
+			throw invalid_argument("Unknown option " + option);
+	}
+
+	if (options.format != "csv" && options.format != "json")
+		throw invalid_argument("Unknown format " + options.format);
+	return options;
+}
+
+template<class T>
+static void AddContinuous(vector<Problem>& pProblems, string pName) {
+	// Plain, then shifted and rotated
+	pProblems.push_back({ pName, CONTINUOUS, [] (ullong pSeed) {
+		return make_shared<T>();
+	}, 1e-8 });
+	pProblems.push_back({ pName + "-SR", CONTINUOUS, [] (ullong pSeed) {
+		return make_shared<T>(1, true, pSeed);
+	}, 1e-8 });
+}
+
+static vector<Problem> CreateProblems(const BenchmarkOptions& pOptions) {
+	vector<Problem> problems;
+
+	AddContinuous<SphereFunction>(problems, "Sphere");
+	AddContinuous<EllipsoidFunction>(problems, "Ellipsoid");
+	AddContinuous<RastriginFunction>(problems, "Rastrigin");
+	AddContinuous<RosenbrockFunction>(problems, "Rosenbrock");
+	AddContinuous<AckleyFunction>(problems, "Ackley");
+
+	problems.push_back({ "OneMax", BIT_STRING, [] (ullong pSeed) {
+		return make_shared<OneMaxFunction>();
+	}, double(pOptions.length) });
+	problems.push_back({ "LeadingOnes", BIT_STRING, [] (ullong pSeed) {
+		return make_shared<LeadingOnesFunction>();
+	}, double(pOptions.length) });
+	problems.push_back({ "NKLandscape-K4", BIT_STRING, [] (ullong pSeed) {
+		return make_shared<NKLandscapeFunction>(4, pSeed);
+	}, NAN });
+
+	problems.push_back({ "TSP", PERMUTATION, [] (ullong pSeed) {
+		return make_shared<TSPFunction>(pSeed);
+	}, NAN });
+
+	return problems;
+}
+
+static vector<BenchmarkStrategy> CreateStrategies() {
+	vector<BenchmarkStrategy> strategies;
+
+	strategies.push_back({ "CMAES", { CONTINUOUS }, [] (ProblemKind pKind, uint pSize, const ScalarEvaluatorPtr& pEvaluator) {
+		auto strategy = make_shared<CMAEvolutionStrategy>(pSize, 1);
+		strategy->evaluator.Set(pEvaluator);
+		return strategy;
+	} });
+
+	strategies.push_back({ "ES", { CONTINUOUS, BIT_STRING, PERMUTATION },
+			[] (ProblemKind pKind, uint pSize, const ScalarEvaluatorPtr& pEvaluator) {
+		auto strategy = make_shared<EvolutionStrategy>(100);
+		strategy->evaluator.Set(pEvaluator);
+		strategy->survivalSelector.Create<GreedySelection>();
+
+		if (pKind == CONTINUOUS) {
+			auto randomizer = make_shared<DoubleRandomizer>(-5, 5);
+			strategy->initializer.Create<DoubleRandomArrayInitializer>(pSize, randomizer);
+			strategy->recombinators.CreateBase<DoubleUniformCrossover>()->Parent<UniformSelection>();
+			strategy->mutators.CreateBase<DoublePointResetMutation>(1.0 / pSize, randomizer);
+		} else if (pKind == BIT_STRING) {
+			strategy->initializer.Create<BoolRandomArrayInitializer>(pSize);
+			strategy->recombinators.CreateBase<BoolUniformCrossover>()->Parent<TournamentSelection>(2);
+			strategy->mutators.CreateBase<FlipBitMutation>(1.0 / pSize);
+		} else {
+			strategy->initializer.Create<PermutationInitializer>(pSize);
+			strategy->recombinators.CreateBase<OrderCrossover>()->Parent<TournamentSelection>(2);
+			strategy->mutators.CreateBase<InversionMutation>()->SetRate(0.5);
+		}
+		return strategy;
+	} });
+
+	return strategies;
+}
+
+static uint GetSize(ProblemKind pKind, const BenchmarkOptions& pOptions) {
+	switch (pKind) {
+	case CONTINUOUS:
+		return pOptions.dimension;
+	case BIT_STRING:
+		return pOptions.length;
+	default:
+		return pOptions.cities;
+	}
+}
+
+static bool IsSelected(const string& pName, const vector<string>& pFilters) {
+	if (pFilters.empty())
+		return true;
+	for (auto& filter : pFilters)
+		if (pName.find(filter) != string::npos)
+			return true;
+	return false;
+}
+
+static RunResult Run(const Problem& pProblem, const BenchmarkStrategy& pStrategy, uint pRun,
+		const BenchmarkOptions& pOptions) {
+	RunResult result { };
+	result.problem = pProblem.name;
+	result.strategy = pStrategy.name;
+	result.size = GetSize(pProblem.kind, pOptions);
+	result.run = pRun;
+
+	auto evaluator = pProblem.create(pOptions.seed);
+	auto strategy = pStrategy.create(pProblem.kind, result.size, evaluator);
+	auto hook = strategy->hooks.Create<TargetHook>(pProblem.target, evaluator->IsMaximizer(), pOptions.budget);
+
+	Random::Seed(pOptions.seed + pRun);
+	auto start = chrono::steady_clock::now();
+	auto session = strategy->Evolve();
+	result.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+	result.success = hook->success;
+	result.evalsToTarget = hook->evalsToTarget;
+	result.evaluations = session->GetPopulation()->GetEvaluation();
+	result.generations = session->GetPopulation()->GetGeneration();
+	result.best = hook->best;
+	return result;
+}
+
+struct Summary {
+	string problem;
+	string strategy;
+	uint runs;
+	uint successes;
+	double medianEvals;
+	double ert;
+	double medianSeconds;
+	double medianBest;
+};
+
+static double Median(vector<double> pValues) {
+	if (pValues.empty())
+		return NAN;
+	sort(pValues.begin(), pValues.end());
+	uint n = pValues.size();
+	return n % 2 ? pValues[n / 2] : (pValues[n / 2 - 1] + pValues[n / 2]) / 2;
+}
+
+static vector<Summary> Summarize(const vector<RunResult>& pResults) {
+	vector<Summary> summaries;
+	for (uint i = 0; i < pResults.size();) {
+		uint j = i;
+		vector<double> evals, seconds, best;
+		double total = 0;
+		uint successes = 0;
+		for (; j < pResults.size() && pResults[j].problem == pResults[i].problem
+				&& pResults[j].strategy == pResults[i].strategy; j++) {
+			auto& result = pResults[j];
+			if (result.success) {
+				successes++;
+				evals.push_back(result.evalsToTarget);
+				total += result.evalsToTarget;
+			} else
+				total += result.evaluations;
+			seconds.push_back(result.seconds);
+			best.push_back(result.best);
+		}
+
+		summaries.push_back({ pResults[i].problem, pResults[i].strategy, j - i, successes, Median(evals),
+				successes > 0 ? total / successes : NAN, Median(seconds), Median(best) });
+		i = j;
+	}
+	return summaries;
+}
+
+static string Number(double pValue) {
+	if (std::isnan(pValue))
+		return "";
+	ostringstream oss;
+	oss << setprecision(6) << pValue;
+	return oss.str();
+}
+
+static string JsonNumber(double pValue) {
+	return std::isnan(pValue) ? "null" : Number(pValue);
+}
+
+static void WriteCsv(ostream& pStream, const vector<RunResult>& pResults, const BenchmarkOptions& pOptions) {
+	pStream << "label,problem,strategy,size,run,success,evals_to_target,evaluations,generations,seconds,best" << endl;
+	for (auto& result : pResults)
+		pStream << pOptions.label << ',' << result.problem << ',' << result.strategy << ',' << result.size << ','
+				<< result.run << ',' << result.success << ','
+				<< (result.success ? to_string(result.evalsToTarget) : "") << ',' << result.evaluations << ','
+				<< result.generations << ',' << Number(result.seconds) << ',' << Number(result.best) << endl;
+}
+
+static void WriteJson(ostream& pStream, const vector<RunResult>& pResults, const vector<Summary>& pSummaries,
+		const BenchmarkOptions& pOptions) {
+	pStream << "{\"label\":\"" << pOptions.label << "\",\"seed\":" << pOptions.seed << ",\"budget\":" << pOptions.budget
+			<< ",\"threads\":" << pOptions.threads << ",\"runs\":[";
+	for (uint i = 0; i < pResults.size(); i++) {
+		auto& result = pResults[i];
+		pStream << (i > 0 ? ",\n" : "\n") << "{\"problem\":\"" << result.problem << "\",\"strategy\":\""
+				<< result.strategy << "\",\"size\":" << result.size << ",\"run\":" << result.run
+				<< ",\"success\":" << (result.success ? "true" : "false")
+				<< ",\"evals_to_target\":" << (result.success ? to_string(result.evalsToTarget) : "null")
+				<< ",\"evaluations\":" << result.evaluations << ",\"generations\":" << result.generations
+				<< ",\"seconds\":" << Number(result.seconds) << ",\"best\":" << JsonNumber(result.best) << "}";
+	}
+	pStream << "\n],\"summary\":[";
+	for (uint i = 0; i < pSummaries.size(); i++) {
+		auto& summary = pSummaries[i];
+		pStream << (i > 0 ? ",\n" : "\n") << "{\"problem\":\"" << summary.problem << "\",\"strategy\":\""
+				<< summary.strategy << "\",\"runs\":" << summary.runs << ",\"successes\":" << summary.successes
+				<< ",\"median_evals\":" << JsonNumber(summary.medianEvals) << ",\"ert\":" << JsonNumber(summary.ert)
+				<< ",\"median_seconds\":" << Number(summary.medianSeconds)
+				<< ",\"median_best\":" << JsonNumber(summary.medianBest) << "}";
+	}
+	pStream << "\n]}" << endl;
+}
+
+static void PrintSummary(ostream& pStream, const vector<Summary>& pSummaries) {
+	pStream << endl << left << setw(18) << "problem" << setw(10) << "strategy" << right << setw(8) << "success"
+			<< setw(14) << "median evals" << setw(14) << "ERT" << setw(12) << "median s" << setw(16) << "median best"
+			<< endl;
+	for (auto& summary : pSummaries)
+		pStream << left << setw(18) << summary.problem << setw(10) << summary.strategy << right
+				<< setw(4) << summary.successes << '/' << left << setw(3) << summary.runs << right
+				<< setw(14) << Number(summary.medianEvals) << setw(14) << Number(summary.ert)
+				<< setw(12) << Number(summary.medianSeconds) << setw(16) << Number(summary.medianBest) << endl;
+}
+
+int main(int argc, char** argv) {
+	BenchmarkOptions options;
+	try {
+		options = ParseOptions(argc, argv);
+	} catch (exception& e) {
+		cerr << e.what() << endl;
+		cerr << "Usage: " << argv[0] << " [--problems N1,N2,...] [--strategies N1,N2,...] [--dimension D]"
+				<< " [--length L] [--cities C] [--runs R] [--budget E] [--threads T] [--format csv|json]"
+				<< " [--output FILE] [--label LABEL] [--seed SEED]" << endl;
+		return 1;
+	}
+
+	Log::Clear(Log::DEBUG);
+	Log::Clear(Log::INFO);
+	MultiThreading::SetNumThreads(options.threads);
+
+	vector<RunResult> results;
+	for (auto& problem : CreateProblems(options)) {
+		if (!IsSelected(problem.name, options.problems))
+			continue;
+
+		for (auto& strategy : CreateStrategies()) {
+			if (!IsSelected(strategy.name, options.strategies)
+					|| find(strategy.kinds.begin(), strategy.kinds.end(), problem.kind) == strategy.kinds.end())
+				continue;
+
+			for (uint run = 0; run < options.runs; run++) {
+				RunResult result;
+				try {
+					result = Run(problem, strategy, run, options);
+				} catch (exception& e) {
+					cerr << problem.name << " / " << strategy.name << " (run " << run << "): " << e.what() << endl;
+					continue;
+				}
+
+				results.push_back(result);
+				cerr << problem.name << " / " << strategy.name << " run " << run << ": "
+						<< (result.success ? "reached after " + to_string(result.evalsToTarget) + " evaluations"
+								: "best " + Number(result.best)) << " in " << result.seconds << " s" << endl;
+			}
+		}
+	}
+
+	auto summaries = Summarize(results);
+	PrintSummary(cerr, summaries);
+
+	if (options.output.empty()) {
+		if (options.format == "csv")
+			WriteCsv(cout, results, options);
+		else
+			WriteJson(cout, results, summaries, options);
+	} else {
+		ofstream file(options.output);
+		if (!file) {
+			cerr << "Cannot open " << options.output << endl;
+			return 1;
+		}
+		if (options.format == "csv")
+			WriteCsv(file, results, options);
+		else
+			WriteJson(file, results, summaries, options);
+	}
+	return 0;
+}
@@ -0,0 +1,409 @@
+/*
+ * OperatorBenchmark.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../pch.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <thread>
+#include "../EA.h"
+
+using namespace ea;
+using namespace std;
+
+/*
+ * Throughput benchmark of the built-in operators.
+ *
+ * Every operator is measured for each genome length and each thread count.
+ * A measurement calls the operator repeatedly from MultiThreading::For() (the same way the strategies do)
+ * until the minimum time is reached, and reports the number of calls per second.
+ * For the selectors, the length is the size of the input pool and half of the pool is selected.
+ *
+ * Usage: OperatorBenchmark [options]
+ *   --lengths L1,L2,...   Genome lengths (default: 8,64,512,4096,32768,262144,1000000).
+ *   --threads T1,T2,...   Thread counts (default: 1 and the number of hardware threads).
+ *   --operators N1,N2,... Only run the operators whose name contains one of the given strings.
+ *   --min-time MS         Minimum measuring time of each case in milliseconds (default: 200).
+ *   --max-time MS         Skip the longer lengths of an operator whose call could take longer (default: 5000).
+ *   --format csv|json     Output format (default: csv).
+ *   --output FILE         Write the results to a file instead of stdout.
+ *   --label LABEL         A label added to each result (e.g. the build name) to compare results.
+ *   --seed SEED           The random seed (default: 1).
+ */
+
+#define DEFAULT_LENGTHS "8,64,512,4096,32768,262144,1000000"
+#define INPUT_COUNT 8
+
+struct BenchmarkCase {
+	string name;
+	string params;
+	// Prepare the inputs for a length and return the operation of one call
+	function<function<void(int)>(uint)> prepare;
+};
+
+struct BenchmarkResult {
+	string name;
+	string params;
+	uint length;
+	uint threads;
+	ullong ops;
+	double seconds;
+};
+
+struct BenchmarkOptions {
+	vector<uint> lengths;
+	vector<uint> threads;
+	vector<string> operators;
+	double minTime = 0.2;
+	double maxTime = 5;
+	string format = "csv";
+	string output;
+	string label;
+	llong seed = 1;
+};
+
+static vector<string> Split(const string& pList) {
+	vector<string> result;
+	istringstream iss(pList);
+	string item;
+	while (getline(iss, item, ','))
+		if (!item.empty())
+			result.push_back(item);
+	return result;
+}
+
+static vector<uint> SplitNumbers(const string& pList) {
+	vector<uint> result;
+	for (auto& item : Split(pList))
+		result.push_back(stoul(item));
+	return result;
+}
+
+static BenchmarkOptions ParseOptions(int argc, char** argv) {
+	BenchmarkOptions options;
+	options.lengths = SplitNumbers(DEFAULT_LENGTHS);
+	options.threads = { 1 };
+	uint hardware = thread::hardware_concurrency();
+	if (hardware > 1)
+		options.threads.push_back(hardware);
+
+	for (int i = 1; i < argc; i++) {
+		string option = argv[i];
+		if (i + 1 >= argc)
+			throw invalid_argument("Missing value of option " + option);
+		string value = argv[++i];
+
+		if (option == "--lengths")
+			options.lengths = SplitNumbers(value);
+		else if (option == "--threads")
+			options.threads = SplitNumbers(value);
+		else if (option == "--operators")
+			options.operators = Split(value);
+		else if (option == "--min-time")
+			options.minTime = stod(value) / 1000;
+		else if (option == "--max-time")
+			options.maxTime = stod(value) / 1000;
+		else if (option == "--format")
+			options.format = value;
+		else if (option == "--output")
+			options.output = value;
+		else if (option == "--label")
+			options.label = value;
+		else if (option == "--seed")
+			options.seed = stoll(value);
+		else
+			throw invalid_argument("Unknown option " + option);
+	}
+
+	if (options.format != "csv" && options.format != "json")
+		throw invalid_argument("Unknown format " + options.format);
+	return options;
+}
+
+static vector<GenomePtr> CreateArrays(uint pLength) {
+	auto initializer = make_shared<IntRandomArrayInitializer>(pLength, make_shared<IntRandomizer>(0, 100));
+	auto pool = initializer->Initialize(INPUT_COUNT);
+	return vector<GenomePtr>(pool->begin(), pool->end());
+}
+
+static vector<GenomePtr> CreateBoolArrays(uint pLength) {
+	auto pool = make_shared<BoolRandomArrayInitializer>(pLength)->Initialize(INPUT_COUNT);
+	return vector<GenomePtr>(pool->begin(), pool->end());
+}
+
+static vector<GenomePtr> CreatePermutations(uint pLength) {
+	auto pool = make_shared<PermutationInitializer>(pLength)->Initialize(INPUT_COUNT);
+	return vector<GenomePtr>(pool->begin(), pool->end());
+}
+
+static function<void(int)> MutateCase(MutatorPtr pMutator, vector<GenomePtr> pInputs) {
+	return [pMutator, pInputs] (int i) {
+		pMutator->Apply(pInputs[i % INPUT_COUNT]);
+	};
+}
+
+static function<void(int)> CombineCase(RecombinatorPtr pRecombinator, vector<GenomePtr> pInputs) {
+	return [pRecombinator, pInputs] (int i) {
+		vector<GenomePtr> parents(pRecombinator->GetParentCount());
+		for (uint j = 0; j < parents.size(); j++)
+			parents[j] = pInputs[(i + j) % INPUT_COUNT];
+		pRecombinator->Combine(parents);
+	};
+}
+
+static function<void(int)> SelectCase(Ptr<ResizableSelector> pSelector, uint pLength) {
+	auto pool = make_shared<OrganismPool>(pLength);
+	for (auto& organism : *pool)
+		organism = make_shared<Organism>(nullptr, make_shared<ScalarFitness>(Random::Rate()));
+	pSelector->SetSize(pLength / 2);
+
+	SelectorPtr selector = pSelector;
+	return [selector, pool] (int i) {
+		selector->Select(pool);
+	};
+}
+
+static function<void(int)> InitializeCase(InitializerPtr pInitializer) {
+	return [pInitializer] (int i) {
+		pInitializer->Initialize(1);
+	};
+}
+
+static vector<BenchmarkCase> CreateCases() {
+	vector<BenchmarkCase> cases;
+
+	// Array recombinators
+	cases.push_back({ "IntOnePointCrossover", "", [] (uint pLength) {
+		return CombineCase(make_shared<IntOnePointCrossover>(), CreateArrays(pLength));
+	} });
+	cases.push_back({ "IntNPointCrossover", "cross-count=3", [] (uint pLength) {
+		return CombineCase(make_shared<IntNPointCrossover>(3), CreateArrays(pLength));
+	} });
+	cases.push_back({ "IntUniformCrossover", "", [] (uint pLength) {
+		return CombineCase(make_shared<IntUniformCrossover>(), CreateArrays(pLength));
+	} });
+	cases.push_back({ "BoolNPointCrossover", "cross-count=3", [] (uint pLength) {
+		return CombineCase(make_shared<BoolNPointCrossover>(3), CreateBoolArrays(pLength));
+	} });
+	cases.push_back({ "BoolUniformCrossover", "", [] (uint pLength) {
+		return CombineCase(make_shared<BoolUniformCrossover>(), CreateBoolArrays(pLength));
+	} });
+
+	// Permutation recombinators
+	cases.push_back({ "CycleCrossover", "", [] (uint pLength) {
+		return CombineCase(make_shared<CycleCrossover>(), CreatePermutations(pLength));
+	} });
+	cases.push_back({ "EdgeCrossover", "", [] (uint pLength) {
+		return CombineCase(make_shared<EdgeCrossover>(), CreatePermutations(pLength));
+	} });
+	cases.push_back({ "OrderCrossover", "", [] (uint pLength) {
+		return CombineCase(make_shared<OrderCrossover>(), CreatePermutations(pLength));
+	} });
+	cases.push_back({ "PartiallyMappedCrossover", "", [] (uint pLength) {
+		return CombineCase(make_shared<PartiallyMappedCrossover>(), CreatePermutations(pLength));
+	} });
+
+	// Array mutators (one gene per call on average)
+	cases.push_back({ "FlipBitMutation", "rate=1/length", [] (uint pLength) {
+		return MutateCase(make_shared<FlipBitMutation>(1.0 / pLength), CreateBoolArrays(pLength));
+	} });
+	cases.push_back({ "FlipBitMutation", "rate=0.5", [] (uint pLength) {
+		return MutateCase(make_shared<FlipBitMutation>(0.5), CreateBoolArrays(pLength));
+	} });
+	cases.push_back({ "IntPointResetMutation", "rate=1/length", [] (uint pLength) {
+		return MutateCase(make_shared<IntPointResetMutation>(1.0 / pLength, make_shared<IntRandomizer>(0, 100)),
+				CreateArrays(pLength));
+	} });
+
+	// Permutation mutators
+	cases.push_back({ "InsertMutation", "", [] (uint pLength) {
+		return MutateCase(make_shared<InsertMutation>(), CreatePermutations(pLength));
+	} });
+	cases.push_back({ "InversionMutation", "", [] (uint pLength) {
+		return MutateCase(make_shared<InversionMutation>(), CreatePermutations(pLength));
+	} });
+	cases.push_back({ "ScrambleMutation", "", [] (uint pLength) {
+		return MutateCase(make_shared<ScrambleMutation>(), CreatePermutations(pLength));
+	} });
+	cases.push_back({ "SwapMutation", "", [] (uint pLength) {
+		return MutateCase(make_shared<SwapMutation>(), CreatePermutations(pLength));
+	} });
+
+	// Permutation mutators applying several mutations in one pass
+	cases.push_back({ "InsertMutation", "count=8", [] (uint pLength) {
+		return MutateCase(make_shared<InsertMutation>(8), CreatePermutations(pLength));
+	} });
+	cases.push_back({ "InversionMutation", "count=8", [] (uint pLength) {
+		return MutateCase(make_shared<InversionMutation>(8), CreatePermutations(pLength));
+	} });
+	cases.push_back({ "ScrambleMutation", "count=8", [] (uint pLength) {
+		return MutateCase(make_shared<ScrambleMutation>(8), CreatePermutations(pLength));
+	} });
+	cases.push_back({ "SwapMutation", "count=8", [] (uint pLength) {
+		return MutateCase(make_shared<SwapMutation>(8), CreatePermutations(pLength));
+	} });
+
+	// Selectors (the length is the pool size)
+	cases.push_back({ "GreedySelection", "", [] (uint pLength) {
+		return SelectCase(make_shared<GreedySelection>(), pLength);
+	} });
+	cases.push_back({ "TournamentSelection", "size=4", [] (uint pLength) {
+		return SelectCase(make_shared<TournamentSelection>(4), pLength);
+	} });
+	cases.push_back({ "UniformSelection", "", [] (uint pLength) {
+		return SelectCase(make_shared<UniformSelection>(), pLength);
+	} });
+
+	// Initializers (one genome per call)
+	cases.push_back({ "BoolRandomArrayInitializer", "", [] (uint pLength) {
+		return InitializeCase(make_shared<BoolRandomArrayInitializer>(pLength));
+	} });
+	cases.push_back({ "IntRandomArrayInitializer", "", [] (uint pLength) {
+		return InitializeCase(make_shared<IntRandomArrayInitializer>(pLength, make_shared<IntRandomizer>(0, 100)));
+	} });
+	cases.push_back({ "PermutationInitializer", "", [] (uint pLength) {
+		return InitializeCase(make_shared<PermutationInitializer>(pLength));
+	} });
+
+	return cases;
+}
+
+static double Run(const function<void(int)>& pOperation, ullong pCount) {
+	auto start = chrono::steady_clock::now();
+	MultiThreading::For(0, pCount, pOperation);
+	return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+static BenchmarkResult Measure(const function<void(int)>& pOperation, uint pThreads, double pMinTime) {
+	BenchmarkResult result { };
+	result.threads = pThreads;
+
+	// Warm up with one call per thread, then double the batch until the minimum time is reached
+	double warmup = Run(pOperation, pThreads);
+	ullong batch = pThreads;
+	if (warmup >= pMinTime) {
+		result.ops = batch;
+		result.seconds = warmup;
+		return result;
+	}
+
+	while (result.seconds < pMinTime) {
+		result.seconds += Run(pOperation, batch);
+		result.ops += batch;
+		if (result.seconds < pMinTime / 2)
+			batch *= 2;
+	}
+	return result;
+}
+
+static void WriteCsv(ostream& pStream, const vector<BenchmarkResult>& pResults, const BenchmarkOptions& pOptions) {
+	pStream << "label,operator,params,length,threads,ops,seconds,ops_per_sec,ns_per_op,genes_per_sec" << endl;
+	for (auto& result : pResults)
+		pStream << pOptions.label << ',' << result.name << ',' << result.params << ',' << result.length << ','
+				<< result.threads << ',' << result.ops << ',' << result.seconds << ','
+				<< result.ops / result.seconds << ',' << result.seconds * 1e9 / result.ops << ','
+				<< result.ops * result.length / result.seconds << endl;
+}
+
+static void WriteJson(ostream& pStream, const vector<BenchmarkResult>& pResults, const BenchmarkOptions& pOptions) {
+	pStream << "{\"label\":\"" << pOptions.label << "\",\"seed\":" << pOptions.seed
+			<< ",\"min_time\":" << pOptions.minTime << ",\"results\":[";
+	for (uint i = 0; i < pResults.size(); i++) {
+		auto& result = pResults[i];
+		pStream << (i > 0 ? ",\n" : "\n") << "{\"operator\":\"" << result.name << "\",\"params\":\"" << result.params
+				<< "\",\"length\":" << result.length << ",\"threads\":" << result.threads << ",\"ops\":" << result.ops
+				<< ",\"seconds\":" << result.seconds << ",\"ops_per_sec\":" << result.ops / result.seconds
+				<< ",\"ns_per_op\":" << result.seconds * 1e9 / result.ops
+				<< ",\"genes_per_sec\":" << result.ops * result.length / result.seconds << "}";
+	}
+	pStream << "\n]}" << endl;
+}
+
+static bool IsSelected(const string& pName, const BenchmarkOptions& pOptions) {
+	if (pOptions.operators.empty())
+		return true;
+	for (auto& filter : pOptions.operators)
+		if (pName.find(filter) != string::npos)
+			return true;
+	return false;
+}
+
+int main(int argc, char** argv) {
+	BenchmarkOptions options;
+	try {
+		options = ParseOptions(argc, argv);
+	} catch (exception& e) {
+		cerr << e.what() << endl;
+		cerr << "Usage: " << argv[0] << " [--lengths L1,L2,...] [--threads T1,T2,...] [--operators N1,N2,...]"
+				<< " [--min-time MS] [--max-time MS] [--format csv|json] [--output FILE] [--label LABEL] [--seed SEED]"
+				<< endl;
+		return 1;
+	}
+
+	Random::Seed(options.seed);
+	sort(options.lengths.begin(), options.lengths.end());
+
+	vector<BenchmarkResult> results;
+	for (auto& benchmarkCase : CreateCases()) {
+		if (!IsSelected(benchmarkCase.name, options))
+			continue;
+
+		for (uint threads : options.threads) {
+			MultiThreading::SetNumThreads(threads);
+
+			for (uint length : options.lengths) {
+				BenchmarkResult result;
+				try {
+					auto operation = benchmarkCase.prepare(length);
+					result = Measure(operation, threads, options.minTime);
+				} catch (exception& e) {
+					cerr << benchmarkCase.name << " (length " << length << "): " << e.what() << endl;
+					continue;
+				}
+
+				result.name = benchmarkCase.name;
+				result.params = benchmarkCase.params;
+				result.length = length;
+				results.push_back(result);
+				cerr << result.name << " length " << length << " threads " << threads << ": "
+						<< result.ops / result.seconds << " ops/s" << endl;
+
+				// Skip the longer lengths if a call could take too long (assuming quadratic time)
+				double next = length;
+				for (uint other : options.lengths)
+					if (other > length) {
+						next = other;
+						break;
+					}
+				double scale = next / length;
+				if (result.seconds / result.ops * threads * scale * scale > options.maxTime) {
+					cerr << benchmarkCase.name << ": skipping lengths above " << length << endl;
+					break;
+				}
+			}
+		}
+	}
+
+	if (options.output.empty()) {
+		if (options.format == "csv")
+			WriteCsv(cout, results, options);
+		else
+			WriteJson(cout, results, options);
+	} else {
+		ofstream file(options.output);
+		if (!file) {
+			cerr << "Cannot open " << options.output << endl;
+			return 1;
+		}
+		if (options.format == "csv")
+			WriteCsv(file, results, options);
+		else
+			WriteJson(file, results, options);
+	}
+	return 0;
+}
@@ -10,6 +10,7 @@
 #include "Organism.h"
 #include "interface/Genome.h"
 #include "../fitness/ScalarFitness.h"
+#include "../misc/ObjectCounter.h"
 
 namespace ea {
 
@@ -32,9 +33,20 @@ namespace ea {
  */
 Organism::Organism(const GenomePtr& pGenome, const FitnessPtr& pFitness) :
 		mGenome(pGenome), mFitness(pFitness) {
+	ObjectCounter::Created(ObjectCounter::ORGANISM);
+}
+
+/**
+ * Create an Organism sharing the Genome and the Fitness of another one.
+ * @param pOther The Organism to be copied.
+ */
+Organism::Organism(const Organism& pOther) :
+		Storable(pOther), mGenome(pOther.mGenome), mFitness(pOther.mFitness) {
+	ObjectCounter::Created(ObjectCounter::ORGANISM);
 }
 
 Organism::~Organism() {
+	ObjectCounter::Destroyed(ObjectCounter::ORGANISM);
 }
 
 /**
@@ -18,6 +18,7 @@ using namespace std;
 class Organism final: public Storable {
 public:
 	Organism(GenomePtr const& pGenome = nullptr, FitnessPtr const& pFitness = nullptr);
+	Organism(const Organism& pOther);
 	virtual ~Organism();
 
 	FitnessPtr GetFitness() const;
@@ -0,0 +1,141 @@
+/*
+ * Phase.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../pch.h"
+#include "Phase.h"
+#include <deque>
+#include <mutex>
+
+namespace ea {
+
+/**
+ * @class Phase
+ * Interned identifier of a measured phase (e.g. an operator executed by Strategy::Execute()).
+ * Every distinct phase name is given a small integer ID the first time it is used, so Session can record
+ * the execution time of a phase by indexing an array instead of looking up the name.
+ * The IDs are shared by all Session in the process.
+ *
+ * Creating a Phase from a name takes a lock, so a Phase used in every generation should be created once,
+ * e.g. as a static constant:
+ *
+ * @code
+ * static const Phase EVALUATION("E");
+ * OrganismPoolPtr evaluatedPool = Execute(EVALUATION, evaluator, pool);
+ * @endcode
+ *
+ * A Phase with an empty name is not measured (its ID is NONE).
+ * At most #MAX_COUNT distinct names can be registered, since Session keeps one record per ID:
+ * names must identify phases (e.g. operators), not be generated per call.
+ *
+ * @see Session
+ */
+
+/**
+ * @var Phase::NONE
+ * The ID of the Phase with an empty name, which is not measured.
+ */
+
+/**
+ * @var Phase::MAX_COUNT
+ * The maximum number of distinct phase names.
+ */
+
+#ifndef DOXYGEN_IGNORE
+static mutex sMutex;
+static deque<string> sNames;
+static HashMap<string, uint> sIds;
+static const string sEmpty;
+#endif
+
+/**
+ * Create a Phase with the given name, registering the name if it is new.
+ * An exception is thrown if the name is new and #MAX_COUNT phases are already registered.
+ * @param pName The name of the phase.
+ */
+Phase::Phase(const string& pName) : mId(NONE), mName(&sEmpty) {
+	if (pName.empty())
+		return;
+
+	lock_guard<mutex> lock(sMutex);
+	auto entry = sIds.find(pName);
+	if (entry != sIds.end())
+		mId = entry->second;
+	else {
+		if (sNames.size() >= MAX_COUNT)
+			throw EA_EXCEPTION(EAException, OTHERS,
+					"Phase: Cannot register \"" + pName + "\", the maximum of " + to_string(MAX_COUNT)
+							+ " phases is reached.");
+		mId = sNames.size();
+		sNames.push_back(pName);
+		sIds.emplace(pName, mId);
+	}
+	mName = &sNames[mId];
+}
+
+/**
+ * Create a Phase with the given name, registering the name if it is new.
+ * @param pName The name of the phase.
+ */
+Phase::Phase(const char* pName) : Phase(string(pName)) {
+}
+
+/**
+ * Get the ID of this phase.
+ * @return The interned ID, or NONE if the name is empty.
+ */
+uint Phase::GetId() const {
+	return mId;
+}
+
+/**
+ * Get the name of this phase.
+ * @return The name of the phase.
+ */
+const string& Phase::GetName() const {
+	return *mName;
+}
+
+/**
+ * Whether this phase is the empty phase, which is not measured.
+ * @return true if the name of the phase is empty.
+ */
+bool Phase::IsNone() const {
+	return mId == NONE;
+}
+
+/**
+ * Get the name of the phase with the given ID.
+ * @param pId The ID of the phase.
+ * @return The name of the phase (empty if the ID is not registered).
+ */
+const string& Phase::GetName(uint pId) {
+	lock_guard<mutex> lock(sMutex);
+	return pId < sNames.size() ? sNames[pId] : sEmpty;
+}
+
+/**
+ * Find the ID of a phase name without registering it.
+ * @param pName The name of the phase.
+ * @return The ID of the phase, or NONE if the name is not registered.
+ */
+uint Phase::Find(const string& pName) {
+	lock_guard<mutex> lock(sMutex);
+	auto entry = sIds.find(pName);
+	return entry == sIds.end() ? NONE : entry->second;
+}
+
+/**
+ * Get the number of registered phases.
+ * IDs of registered phases are from 0 to GetCount() - 1.
+ * @return The number of registered phases.
+ */
+uint Phase::GetCount() {
+	lock_guard<mutex> lock(sMutex);
+	return sNames.size();
+}
+
+} /* namespace ea */
@@ -0,0 +1,37 @@
+/*
+ * Phase.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../Common.h"
+
+namespace ea {
+
+using namespace std;
+
+class Phase {
+public:
+	static const uint NONE = UINT_MAX;
+	static const uint MAX_COUNT = 256;
+
+	Phase(const string& pName);
+	Phase(const char* pName);
+
+	uint GetId() const;
+	const string& GetName() const;
+	bool IsNone() const;
+
+	static const string& GetName(uint pId);
+	static uint Find(const string& pName);
+	static uint GetCount();
+
+private:
+	uint mId;
+	const string* mName;
+};
+
+} /* namespace ea */
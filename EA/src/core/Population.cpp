@@ -50,7 +50,7 @@ const string Population::EVALUATION_COUNTER = "evaluation";
  * Create a Population containing nothing.
  * The two counters for generation and evaluation number will be set to 0 by default.
  */
-Population::Population() : mPools(), mCounters() {
+Population::Population() : mPools(), mCounters(), mCheckpoint() {
 	SetCounter(GENERATION_COUNTER, 0);
 	SetCounter(EVALUATION_COUNTER, 0);
 }
@@ -145,6 +145,14 @@ PoolPtr Population::GetPool(uint pIndex) const {
 		return nullptr;
 	}
 }
+/**
+ * Get all Pool stored in the Population.
+ * @return The map of Pool indexed by their index.
+ */
+const map<uint, PoolPtr>& Population::GetPools() const {
+	return mPools;
+}
+
 /**
  * Get a GenomePool stored in the Population.
  * This function is similar to GetPool() with automatic casting to GenomePool.
@@ -202,6 +210,40 @@ void Population::SetPool(uint pIndex, const PoolPtr& pPool) {
  * @param pPool The new Pool object of type P to be set.
  */
 
+/**
+ * Get the state captured by Checkpoint when this Population was backed up.
+ * The checkpoint is a separate record of the back-up file: it is not one of the Pool
+ * and is neither serialized nor copied with the Population (see Restore and Checkpoint::Reinstate()).
+ * @return The captured state (nullptr if the Population was not restored or the back-up has no checkpoint).
+ */
+CheckpointPoolPtr Population::GetCheckpoint() const {
+	return mCheckpoint;
+}
+
+/**
+ * Attach the state captured by Checkpoint to this Population.
+ * @param pCheckpoint The captured state (nullptr to remove it).
+ */
+void Population::SetCheckpoint(const CheckpointPoolPtr& pCheckpoint) {
+	mCheckpoint = pCheckpoint;
+}
+
+/**
+ * Create a snapshot of this Population.
+ * The snapshot contains a copy of all counters and a clone of all pools (see Pool::Clone()),
+ * so it is not affected when the Population continues to evolve.
+ * Genome and Organism objects are shared with this Population since they are not modified after creation.
+ * @return The snapshot of this Population.
+ */
+PopulationPtr Population::Snapshot() const {
+	PopulationPtr snapshot = make_shared<Population>();
+	for (auto& counter : mCounters)
+		snapshot->SetCounter(counter.first, counter.second);
+	for (auto& pool : mPools)
+		snapshot->SetPool(pool.first, pool.second ? pool.second->Clone() : nullptr);
+	return snapshot;
+}
+
 void Population::DoSerialize(ostream& pStream) const {
 	Write(pStream, mCounters);
 	Write(pStream, mPools);
@@ -37,8 +37,11 @@ public:
 	ullong IncreaseGeneration();
 	ullong IncreaseEvaluation();
 
+	PopulationPtr Snapshot() const;
+
 	// Pool management
 	PoolPtr GetPool(uint pIndex) const;
+	const map<uint, PoolPtr>& GetPools() const;
 	void SetPool(uint pIndex, const PoolPtr& pPool);
 	GenomePoolPtr GetGenomePool(uint pIndex) const;
 	OrganismPoolPtr GetOrganismPool(uint pIndex) const;
@@ -50,6 +53,10 @@ public:
 		SetPool(pIndex, static_pointer_cast<Pool>(pPool));
 	}
 
+	// Checkpoint of a restored Population
+	CheckpointPoolPtr GetCheckpoint() const;
+	void SetCheckpoint(const CheckpointPoolPtr& pCheckpoint);
+
 protected:
 	virtual void DoSerialize(ostream& pStream) const override;
 	virtual void DoDeserialize(istream& pStream) override;
@@ -57,6 +64,7 @@ protected:
 private:
 	map<uint, PoolPtr> mPools;
 	CounterMap mCounters;
+	CheckpointPoolPtr mCheckpoint;
 };
 
 } /* namespace ea */
@@ -25,6 +25,11 @@ namespace ea {
  * (which can be queried by GetTimeRecords() and GetTotalTime()),
  * and also providing running status such as IsRunning() and Terminate().
  *
+ * Execution times are recorded per Phase into log-bucketed histograms (see TimeHistogram), so
+ * the records contain percentiles besides the average. Each thread records into its own histograms
+ * without locking; they are merged when the records are queried.
+ * If PerfCounters is enabled, the hardware counters of each phase are recorded as well.
+ *
  * Users shouldn't create a Session instance by themselves, the algorithm won't run.
  * The only way to start an EA is to call the function Strategy::Evolve().
  *
@@ -42,8 +47,13 @@ namespace ea {
  * @param pPopulation The target Population.
  * @param pStrategy The algorithm.
  */
+#ifndef DOXYGEN_IGNORE
+static atomic<ullong> sSerial(0);
+#endif
+
 Session::Session(PopulationPtr pPopulation, StrategyPtr pStrategy)
-	: mPopulation(pPopulation), mStrategy(pStrategy), mTime(), mTotalTime(), mRunning(true) {
+	: mPopulation(pPopulation), mStrategy(pStrategy), mSerial(++sSerial),
+	  mThreadMutex(), mThreadRecords(), mTotalTime(), mRunning(true) {
 
 	// System report
 	if (MultiThreading::GetRealNumThreads() != 1)
@@ -66,43 +76,181 @@ const PopulationPtr& Session::GetPopulation() const {
 const StrategyPtr& Session::GetStrategy() const {
 	return mStrategy;
 }
+Session::~Session() {
+}
+
+/**
+ * @struct Session::TimeRecord
+ * Execution time statistics of a phase.
+ * If PerfCounters is enabled, it also contains the hardware counters of the phase.
+ */
+
+/**
+ * @var Session::MAX_PHASES
+ * The maximum number of distinct phases which can be measured (see Phase::MAX_COUNT).
+ */
+
 /**
  * Get the time records measured in this run.
- * This function returns a list of records, which are pairs of operator ID and the average execution time.
- * If an empty order is received, the function will return all the records existed.
+ * This function returns a list of records, each contains the phase ID, the number of executions,
+ * the total and average execution time and the percentiles of the execution time.
+ * If an empty order is received, the function will return all the records existed, sorted by ID.
  * Otherwise, the order of the returned list will be identical to the given order.
  * Non-existing records are ignored.
  * The order list can be get from Strategy::GetTimeRecordOrder().
  *
+ * This function can be called from another thread while the evolution is running.
+ *
  * @param pOrder A list of IDs representing the wanted order of the output.
- * @return A list of records, each is a pair of operator ID and average execution time.
+ * @return A list of records.
  */
-vector<pair<string, float>> Session::GetTimeRecords(vector<string> pOrder) const {
-	vector<pair<string, float>> result;
+vector<Session::TimeRecord> Session::GetTimeRecords(vector<string> pOrder) const {
+	map<string, TimeHistogram> histograms;
+	map<string, PhaseCounters> counters;
+	{
+		lock_guard<mutex> lock(mThreadMutex);
+		for (auto& records : mThreadRecords)
+			for (uint i = 0; i < MAX_PHASES; i++) {
+				TimeHistogram* histogram = records->histograms[i].load(memory_order_acquire);
+				if (histogram)
+					histograms[Phase::GetName(i)].Merge(*histogram);
+
+				PhaseCounters* phaseCounters = records->counters[i].load(memory_order_acquire);
+				if (phaseCounters) {
+					PhaseCounters& total = counters[Phase::GetName(i)];
+					total.count += phaseCounters->count.load(memory_order_relaxed);
+					for (uint j = 0; j < PerfCounters::NUM_EVENTS; j++)
+						total.values[j] += phaseCounters->values[j].load(memory_order_relaxed);
+				}
+			}
+	}
+
+	auto makeRecord = [&counters] (const string& pId, const TimeHistogram& pHistogram) {
+		auto entry = counters.find(pId);
+		return MakeRecord(pId, pHistogram, entry == counters.end() ? nullptr : &entry->second);
+	};
+
+	vector<TimeRecord> result;
 	if (pOrder.size() == 0) {
-		for (auto pair : mTime)
-			result.push_back({pair.first, pair.second.Average()});
+		for (auto& entry : histograms)
+			result.push_back(makeRecord(entry.first, entry.second));
 	}
 	else {
-		for (auto id : pOrder)
-			if (mTime.find(id) != mTime.end())
-				result.push_back({id, mTime.at(id).Average()});
+		for (auto& id : pOrder) {
+			auto entry = histograms.find(id);
+			if (entry != histograms.end())
+				result.push_back(makeRecord(id, entry->second));
+		}
 	}
 	return result;
 }
 
+/**
+ * Get the time record of whole generations.
+ * @return The record of generational execution time (with ID "Total").
+ */
+Session::TimeRecord Session::GetTotalTimeRecord() const {
+	return MakeRecord("Total", mTotalTime);
+}
+
 /**
  * Get the average execution time of a generation.
  * @return The generational average execution time.
  */
 float Session::GetTotalTime() const {
-	return mTotalTime.Average();
+	return mTotalTime.GetAverage();
+}
+
+Session::TimeRecord Session::MakeRecord(string pId, const TimeHistogram& pHistogram, const PhaseCounters* pCounters) {
+	TimeRecord record = { pId, pHistogram.GetCount(), pHistogram.GetTotal(), pHistogram.GetAverage(),
+		pHistogram.GetPercentile(50), pHistogram.GetPercentile(90), pHistogram.GetPercentile(99), pHistogram.GetMax(),
+		0, { } };
+	if (pCounters) {
+		record.counted = pCounters->count.load(memory_order_relaxed);
+		for (uint i = 0; i < PerfCounters::NUM_EVENTS; i++)
+			record.counters[i] = pCounters->values[i].load(memory_order_relaxed);
+	}
+	return record;
+}
+
+Session::PhaseCounters::PhaseCounters() : count(0) {
+	for (auto& value : values)
+		value.store(0, memory_order_relaxed);
+}
+
+Session::ThreadRecords::ThreadRecords() : owner(this_thread::get_id()) {
+	for (auto& histogram : histograms)
+		histogram.store(nullptr, memory_order_relaxed);
+	for (auto& phaseCounters : counters)
+		phaseCounters.store(nullptr, memory_order_relaxed);
+}
+
+Session::ThreadRecords::~ThreadRecords() {
+	for (auto& histogram : histograms)
+		delete histogram.load(memory_order_relaxed);
+	for (auto& phaseCounters : counters)
+		delete phaseCounters.load(memory_order_relaxed);
+}
+
+Session::ThreadRecords& Session::GetThreadRecords() {
+	static thread_local ullong tSerial = 0;
+	static thread_local ThreadRecords* tRecords = nullptr;
+	if (tSerial == mSerial)
+		return *tRecords;
+
+	lock_guard<mutex> lock(mThreadMutex);
+	thread::id id = this_thread::get_id();
+	auto found = find_if(mThreadRecords.begin(), mThreadRecords.end(),
+			[id] (const unique_ptr<ThreadRecords>& pRecords) { return pRecords->owner == id; });
+	if (found == mThreadRecords.end()) {
+		mThreadRecords.emplace_back(new ThreadRecords());
+		found = mThreadRecords.end() - 1;
+	}
+
+	tSerial = mSerial;
+	tRecords = found->get();
+	return *tRecords;
+}
+
+// Phase IDs are below MAX_PHASES since Phase refuses to register more names
+void Session::Record(uint pPhase, ullong pNanos) {
+	auto& slot = GetThreadRecords().histograms[pPhase];
+	TimeHistogram* histogram = slot.load(memory_order_relaxed);
+	if (!histogram) {
+		histogram = new TimeHistogram();
+		slot.store(histogram, memory_order_release);
+	}
+	histogram->Add(pNanos);
+}
+
+void Session::RecordCounters(uint pPhase, const PerfCounters::Values& pStart, Tracer::Scope& pTrace) {
+	PerfCounters::Values end;
+	if (!PerfCounters::Read(end))
+		return;
+
+	auto& slot = GetThreadRecords().counters[pPhase];
+	PhaseCounters* phaseCounters = slot.load(memory_order_relaxed);
+	if (!phaseCounters) {
+		phaseCounters = new PhaseCounters();
+		slot.store(phaseCounters, memory_order_release);
+	}
+
+	// Single writer per thread: relaxed load and store are enough
+	phaseCounters->count.store(phaseCounters->count.load(memory_order_relaxed) + 1, memory_order_relaxed);
+	for (uint i = 0; i < PerfCounters::NUM_EVENTS; i++) {
+		if (!(end.valid & (1 << i)))
+			continue;
+		ullong delta = end.values[i] > pStart.values[i] ? end.values[i] - pStart.values[i] : 0;
+		auto& value = phaseCounters->values[i];
+		value.store(value.load(memory_order_relaxed) + delta, memory_order_relaxed);
+		pTrace.AddArg(PerfCounters::GetName(i), delta);
+	}
 }
 
 void Session::MeasureTotalTime(function<void(void)> pFunc) {
-	chrono::time_point<chrono::high_resolution_clock> t(chrono::high_resolution_clock::now());
+	auto t = chrono::steady_clock::now();
 	pFunc();
-    mTotalTime.Add(MilisFloat(chrono::high_resolution_clock::now() - t));
+	mTotalTime.Add(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - t).count());
 }
 
 /**
@@ -8,8 +8,14 @@
 #pragma once
 
 #include "../EA/Type/Core.h"
+#include "Phase.h"
+#include "../misc/TimeHistogram.h"
+#include "../misc/Tracer.h"
+#include "../misc/PerfCounters.h"
 #include <atomic>
 #include <chrono>
+#include <mutex>
+#include <thread>
 
 namespace ea {
 
@@ -18,60 +24,92 @@ using namespace std;
 class Session final {
 public:
 	Session(PopulationPtr pPopulation, StrategyPtr pStrategy);
+	~Session();
 
 	const PopulationPtr& GetPopulation() const;
 	const StrategyPtr& GetStrategy() const;
 
-	vector<pair<string, float>> GetTimeRecords(vector<string> pOrder = { }) const;
+	struct TimeRecord {
+		string id;			///< The phase ID.
+		ullong count;		///< The number of executions.
+		float total;		///< The total execution time (ms).
+		float average;		///< The average execution time (ms).
+		float p50;			///< The median execution time (ms).
+		float p90;			///< The 90th percentile of execution time (ms).
+		float p99;			///< The 99th percentile of execution time (ms).
+		float max;			///< The longest execution time (ms).
+		ullong counted;		///< The number of executions measured by PerfCounters (0 if disabled or unavailable).
+		ullong counters[PerfCounters::NUM_EVENTS];	///< The total counter values of the counted executions.
+	};
+
+	vector<TimeRecord> GetTimeRecords(vector<string> pOrder = { }) const;
+	TimeRecord GetTotalTimeRecord() const;
 	float GetTotalTime() const;
 
 	bool IsRunning() const;
 	void Terminate();
 
+	static const uint MAX_PHASES = Phase::MAX_COUNT;
+
 private:
 	PopulationPtr mPopulation;
 	StrategyPtr mStrategy;
 
-	using MilisFloat = chrono::duration<float, milli>;
-	struct TimeRecord {
-		MilisFloat totalTime;
-		uint count;
-		TimeRecord() : totalTime(0), count(0) { }
-		float Average() const { return totalTime.count() / count; }
-
-		void Add(MilisFloat duration) {
-			totalTime += duration;
-			count++;
-		}
+	struct PhaseCounters {
+		atomic<ullong> count;
+		atomic<ullong> values[PerfCounters::NUM_EVENTS];
+		PhaseCounters();
 	};
-	map<string, TimeRecord> mTime;
-	TimeRecord mTotalTime;
+	struct ThreadRecords {
+		thread::id owner;
+		atomic<TimeHistogram*> histograms[MAX_PHASES];
+		atomic<PhaseCounters*> counters[MAX_PHASES];
+		ThreadRecords();
+		~ThreadRecords();
+	};
+	const ullong mSerial;
+	mutable mutex mThreadMutex;
+	vector<unique_ptr<ThreadRecords>> mThreadRecords;
+	TimeHistogram mTotalTime;
 
 	atomic<bool> mRunning;
 
-	template<class ReturnT, class... Args>
-	ReturnT	Measure(string id, function<ReturnT(Args...)> pFunc, Args&&... args) {
-		chrono::time_point<chrono::high_resolution_clock> t;
-		if (!id.empty())
-			t = chrono::high_resolution_clock::now();
-
-		ReturnT rValue = pFunc(std::forward(args)...);
-
-		if (!id.empty())
-			mTime[id].Add(MilisFloat(chrono::high_resolution_clock::now() - t));
-
-		return rValue;
-	}
-	template<class... Args>
-	void Measure(string id, function<void(Args...)> pFunc, Args&&... args) {
-		chrono::time_point<chrono::high_resolution_clock> t;
-		if (!id.empty())
-			t = chrono::high_resolution_clock::now();
-
-		pFunc(std::forward(args)...);
+	ThreadRecords& GetThreadRecords();
+	void Record(uint pPhase, ullong pNanos);
+	void RecordCounters(uint pPhase, const PerfCounters::Values& pStart, Tracer::Scope& pTrace);
+	static TimeRecord MakeRecord(string pId, const TimeHistogram& pHistogram, const PhaseCounters* pCounters = nullptr);
+
+	class Timer {
+	public:
+		inline Timer(Session& pSession, const Phase& pPhase, Tracer::Scope& pTrace) :
+				mSession(pSession), mPhase(pPhase.GetId()), mTrace(pTrace), mCounting(false), mCounters(), mStart() {
+			if (mPhase != Phase::NONE) {
+				mCounting = PerfCounters::IsEnabled() && PerfCounters::Read(mCounters);
+				mStart = chrono::steady_clock::now();
+			}
+		}
+		inline ~Timer() {
+			if (mPhase != Phase::NONE) {
+				mSession.Record(mPhase, chrono::duration_cast<chrono::nanoseconds>(
+						chrono::steady_clock::now() - mStart).count());
+				if (mCounting)
+					mSession.RecordCounters(mPhase, mCounters, mTrace);
+			}
+		}
+	private:
+		Session& mSession;
+		uint mPhase;
+		Tracer::Scope& mTrace;
+		bool mCounting;
+		PerfCounters::Values mCounters;
+		chrono::steady_clock::time_point mStart;
+	};
 
-		if (!id.empty())
-			mTime[id].Add(MilisFloat(chrono::high_resolution_clock::now() - t));
+	template<class FuncT>
+	auto Measure(const Phase& pPhase, FuncT&& pFunc) -> decltype(pFunc()) {
+		Tracer::Scope trace(pPhase.GetName(), "phase");
+		Timer timer(*this, pPhase, trace);
+		return pFunc();
 	}
 	void MeasureTotalTime(function<void(void)> pFunc);
 
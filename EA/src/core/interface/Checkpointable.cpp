@@ -0,0 +1,41 @@
+/*
+ * Checkpointable.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../../pch.h"
+#include "Checkpointable.h"
+
+namespace ea {
+
+/**
+ * @class Checkpointable
+ * The interface for components which have internal state to be saved in checkpoints.
+ * Operators and Hook which keep state between generations (e.g. counters, estimations, adaptive parameters)
+ * should implement this interface, so a run restored from a back-up continues exactly like the original run.
+ *
+ * The state is captured by BackupHook (see Checkpoint) and given back to the component
+ * when a Strategy evolves a restored Population. Strategy::GetCheckpointables() decides which
+ * components are included.
+ *
+ * @see Checkpoint
+ */
+
+Checkpointable::~Checkpointable() {
+}
+
+/**
+ * @fn void Checkpointable::SaveState(ostream& pStream)
+ * Write the internal state of the component to the stream.
+ * @param pStream The output stream.
+ */
+
+/**
+ * @fn void Checkpointable::LoadState(istream& pStream)
+ * Read the internal state written by SaveState() from the stream.
+ * @param pStream The input stream.
+ */
+
+} /* namespace ea */
@@ -0,0 +1,24 @@
+/*
+ * Checkpointable.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../../EA/Type/Core.h"
+
+namespace ea {
+
+using namespace std;
+
+class Checkpointable {
+public:
+	virtual ~Checkpointable();
+
+	virtual void SaveState(ostream& pStream) = 0;
+	virtual void LoadState(istream& pStream) = 0;
+};
+
+} /* namespace ea */
@@ -8,6 +8,7 @@
 
 #include "../../pch.h"
 #include "Fitness.h"
+#include "../../misc/ObjectCounter.h"
 
 namespace ea {
 
@@ -36,7 +37,26 @@ namespace ea {
  * @see operator ==()
  */
 
+Fitness::Fitness() {
+	ObjectCounter::Created(ObjectCounter::FITNESS);
+}
+
+Fitness::Fitness(const Fitness& pOther) :
+		Storable(pOther) {
+	ObjectCounter::Created(ObjectCounter::FITNESS);
+}
+
 Fitness::~Fitness() {
+	ObjectCounter::Destroyed(ObjectCounter::FITNESS);
+}
+
+/**
+ * Get the memory used by this Fitness object (see ObjectCounter).
+ * Child classes should override this to return their own size (and the heap memory they own).
+ * @return The footprint in bytes (excluding the allocator overhead).
+ */
+size_t Fitness::GetMemoryUsage() const {
+	return sizeof(Fitness);
 }
 
 /**
@@ -16,9 +16,12 @@ namespace ea {
 
 class Fitness : public Storable {
 public:
+	Fitness();
+	Fitness(const Fitness& pOther);
 	virtual ~Fitness();
 
 	virtual int Compare(const Fitness& other) const = 0;
+	virtual size_t GetMemoryUsage() const;
 
 	bool operator <(const Fitness& other) const;
 	bool operator ==(const Fitness& other) const;
@@ -11,6 +11,7 @@
 #include "../../EA/Type/Core.h"
 #include <iostream>
 #include "../../rtoc/Storable.h"
+#include "../../misc/ObjectCounter.h"
 
 namespace ea {
 
@@ -30,7 +31,14 @@ using namespace std;
  */
 class Genome: public virtual Storable {
 public:
+	inline Genome() {
+		ObjectCounter::Created(ObjectCounter::GENOME);
+	}
+	inline Genome(const Genome& pOther) {
+		ObjectCounter::Created(ObjectCounter::GENOME);
+	}
 	inline virtual ~Genome() {
+		ObjectCounter::Destroyed(ObjectCounter::GENOME);
 	}
 
 	/**
@@ -54,6 +62,16 @@ public:
 		os << "<Genome>";
 		return os;
 	}
+	/**
+	 * Get the memory used by this Genome (see ObjectCounter).
+	 *
+	 * Child classes which own heap memory should add it to the size of the object.
+	 *
+	 * @return The footprint in bytes (excluding the allocator overhead).
+	 */
+	inline virtual size_t GetMemoryUsage() const {
+		return sizeof(Genome);
+	}
 };
 
 /**
@@ -102,6 +120,10 @@ public:
 	{
 		return make_shared_base(Genome, T, (*static_cast<const T*>(this)));
 	}
+
+	inline virtual size_t GetMemoryUsage() const override {
+		return sizeof(T);
+	}
 };
 
 } /* namespace ea */
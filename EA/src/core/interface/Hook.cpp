@@ -37,6 +37,7 @@ Hook::~Hook() {
 
 #define HOOK_FUNC(NAME)\
 	void Hook::NAME() {\
+		Tracer::Scope trace(Tracer::IsEnabled() ? GetTypeNameSafe("Hook") + "::" #NAME : string(), "hook");\
 		try {\
 			Do##NAME();\
 		} catch (exception& e) {\
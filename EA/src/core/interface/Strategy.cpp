@@ -8,6 +8,7 @@
 #include "../../pch.h"
 #include "Strategy.h"
 #include "../../EA/Core.h"
+#include "../../utility/Checkpoint.h"
 
 namespace ea {
 
@@ -64,6 +65,20 @@ namespace ea {
  * @return Whether the Strategy is ready. Default implementation is always true.
  */
 
+/**
+ * @fn void Strategy::CollectCheckpointables(vector<CheckpointablePtr>& pList, const Operator<T>& pOp)
+ * Append the wrapped operator to the list if it is Checkpointable.
+ * @param pList The list to append to.
+ * @param pOp The operator wrapper.
+ */
+
+/**
+ * @fn void Strategy::CollectCheckpointables(vector<CheckpointablePtr>& pList, const OperatorGroup<T>& pGroup)
+ * Append all Checkpointable operators of the group to the list.
+ * @param pList The list to append to.
+ * @param pGroup The operator group.
+ */
+
 /**
  * @fn void Strategy::Setup()
  * Procedure to initialize a new Population.
@@ -136,6 +151,8 @@ void Strategy::Evolve(SessionPtr& pSession, PopulationPtr pPopulation) {
 	else {
 		mPopulation = pPopulation;
 		pSession = mSession = make_shared<Session>(mPopulation, static_pointer_cast<Strategy>(shared_from_this()));
+
+		Checkpoint::Reinstate(mPopulation, static_pointer_cast<Strategy>(shared_from_this()));
 	}
 
 	// Evolution process
@@ -149,6 +166,7 @@ void Strategy::Evolve(SessionPtr& pSession, PopulationPtr pPopulation) {
 
 	while (mSession->IsRunning()) {
 		GetPopulation()->IncreaseGeneration();
+		Tracer::Scope trace("Generation", "strategy");
 		mSession->MeasureTotalTime(bind(&Strategy::Loop, this));
 
 		EA_LOG_TRACE << "Gen " << GetPopulation()->GetGeneration() << ", global hooks Generational" << flush;
@@ -165,11 +183,29 @@ void Strategy::Evolve(SessionPtr& pSession, PopulationPtr pPopulation) {
 
 	// Time report
 	LogStream timeStr(Log::DEBUG);
-	timeStr << "Time Report:";
+	timeStr << "Time Report (avg, p50/p90/p99/max ms):";
 	auto records = GetSession()->GetTimeRecords(GetTimeRecordOrder());
-	for (auto record : records)
-		timeStr << " [" << record.first << "] " << record.second;
-	timeStr << " [Total] " << GetSession()->GetTotalTime() << " ms " << flush;
+	records.push_back(GetSession()->GetTotalTimeRecord());
+	for (auto& record : records)
+		timeStr << " [" << record.id << "] " << record.average << " ("
+				<< record.p50 << "/" << record.p90 << "/" << record.p99 << "/" << record.max << ")";
+	timeStr << flush;
+
+	// Counter report (only the phases measured by PerfCounters, which excludes the total time)
+	if (any_of(records.begin(), records.end(), [] (const Session::TimeRecord& pRecord) { return pRecord.counted > 0; })) {
+		LogStream counterStr(Log::DEBUG);
+		counterStr << "Counter Report (per execution: instructions, IPC, cache misses, branch misses):";
+		for (auto& record : records) {
+			if (record.counted == 0)
+				continue;
+			auto perExecution = [&record] (uint pEvent) { return double(record.counters[pEvent]) / record.counted; };
+			double cycles = record.counters[PerfCounters::CYCLES];
+			counterStr << " [" << record.id << "] " << perExecution(PerfCounters::INSTRUCTIONS) << ", "
+					<< (cycles > 0 ? record.counters[PerfCounters::INSTRUCTIONS] / cycles : 0) << ", "
+					<< perExecution(PerfCounters::CACHE_MISSES) << ", " << perExecution(PerfCounters::BRANCH_MISSES);
+		}
+		counterStr << flush;
+	}
 
 	// Prevent cyclic reference
 	mPopulation = nullptr;
@@ -191,6 +227,20 @@ SessionPtr Strategy::Evolve(PopulationPtr pPopulation) {
 	return session;
 }
 
+/**
+ * Get the components of this Strategy whose internal state is saved in back-ups.
+ * The default implementation returns the Checkpointable hooks in @ref hooks.
+ * Strategies with other operator wrappers should override this function and add their
+ * operators using CollectCheckpointables(). The order of the list must be deterministic.
+ * @return The list of Checkpointable components.
+ * @see Checkpoint
+ */
+vector<CheckpointablePtr> Strategy::GetCheckpointables() const {
+	vector<CheckpointablePtr> list;
+	CollectCheckpointables(list, hooks);
+	return list;
+}
+
 /**
  * Store the given Pool to the processing Population.
  * @param pIndex The index of the Pool.
@@ -274,21 +324,21 @@ const SessionPtr& Strategy::GetSession() const {
  */
 
 /**
- * @fn ReturnT Strategy::Execute(string pId, function<ReturnT(Args&&...)> pFunc, Args&&... args)
+ * @fn ReturnT Strategy::Execute(const Phase& pPhase, function<ReturnT(Args&&...)> pFunc, Args&&... args)
  * Execute the given function with the corresponding arguments under the given operator ID.
  * This function will execute the function and measure the time of the execution.
  * This is an alias version of Session::Measure().
  *
  * @tparam ReturnT The return type of the function (auto-deduced).
  * @tparam Args The type of the arguments (auto-deduced).
- * @param pId The operator ID, which is used to track the identity of the operator.
+ * @param pPhase The operator ID, which is used to track the identity of the operator (see Phase).
  * @param pFunc The function to be executed.
  * @param args The arguments to be forwarded to the function.
  * @return The return value of the given function.
  */
 
 /**
- * @fn OpT::OutputType Strategy::Execute(string pId, const Operator<OpT>& pOp, Args&&... args)
+ * @fn OpT::OutputType Strategy::Execute(const Phase& pPhase, const Operator<OpT>& pOp, Args&&... args)
  * Execute the given Operator with the corresponding arguments under the given operator ID.
  * This function will execute the Operator and measure the time of the execution.
  * The current Session object will be included to Operator::operator() as the first arguments, then
@@ -296,14 +346,14 @@ const SessionPtr& Strategy::GetSession() const {
  *
  * @tparam OpT The type of the Operator (auto-deduced).
  * @tparam Args The type of the arguments (auto-deduced).
- * @param pId The operator ID, which is used to track the identity of the operator.
+ * @param pPhase The operator ID, which is used to track the identity of the operator (see Phase).
  * @param pOp The Operator to be executed.
  * @param args The arguments to be forwarded to the function.
  * @return The return value of the given Operator.
  */
 
 /**
- * @fn OperatorGroup< OpT >::ReturnType Strategy::ExecuteInParallel(string pId, const OperatorGroup<OpT>& pGroup, Args&&... args)
+ * @fn OperatorGroup< OpT >::ReturnType Strategy::ExecuteInParallel(const Phase& pPhase, const OperatorGroup<OpT>& pGroup, Args&&... args)
  * Execute the given OperatorGroup in parallel with the corresponding arguments under the given operator ID.
  * This function will execute the OperatorGroup and measure the time of the execution.
  * The current Session object will be included to OperatorGroup::InParallel() as the first arguments, then
@@ -311,14 +361,14 @@ const SessionPtr& Strategy::GetSession() const {
  *
  * @tparam OpT The type of the Operator (auto-deduced).
  * @tparam Args The type of the arguments (auto-deduced).
- * @param pId The operator ID, which is used to track the identity of the operator.
+ * @param pPhase The operator ID, which is used to track the identity of the operator (see Phase).
  * @param pGroup The OperatorGroup to be executed.
  * @param args The arguments to be forwarded to the function.
  * @return The return value of the given OperatorGroup.
  */
 
 /**
- * @fn OpT::OutputType Strategy::ExecuteInSeries(string pId, const SeriesOperatorGroup<OpT>& pGroup,
+ * @fn OpT::OutputType Strategy::ExecuteInSeries(const Phase& pPhase, const SeriesOperatorGroup<OpT>& pGroup,
  * typename SeriesOperatorGroup<OpT>::ProcessingType pData, Args&&... args)
  * Execute the given SeriesOperatorGroup in series with the corresponding arguments under the given operator ID.
  * This function will execute the SeriesOperatorGroup and measure the time of the execution.
@@ -327,7 +377,7 @@ const SessionPtr& Strategy::GetSession() const {
  *
  * @tparam OpT The type of the Operator (auto-deduced).
  * @tparam Args The type of the arguments (auto-deduced).
- * @param pId The operator ID, which is used to track the identity of the operator.
+ * @param pPhase The operator ID, which is used to track the identity of the operator (see Phase).
  * @param pGroup The SeriesOperatorGroup to be executed.
  * @param pData The input data to be processed.
  * @param args The arguments to be forwarded to the function.
@@ -15,6 +15,7 @@
 #include "../../core/OperatorGroup.h"
 #include "../../core/SeriesOperatorGroup.h"
 #include "../../core/interface/Hook.h"
+#include "../../core/interface/Checkpointable.h"
 #include "../../rtoc/Constructible.h"
 
 namespace ea {
@@ -30,6 +31,10 @@ public:
 	void Evolve(SessionPtr& pSession, PopulationPtr pPopulation = nullptr);
 
 	virtual bool IsReady() { return true; }
+	virtual vector<CheckpointablePtr> GetCheckpointables() const;
+	virtual vector<string> GetTimeRecordOrder() const {
+		return vector<string>();
+	}
 
 	OperatorGroup<Hook> hooks;
 
@@ -39,13 +44,24 @@ protected:
 	virtual void Loop() = 0;
 	virtual void End() { }
 
-	virtual vector<string> GetTimeRecordOrder() const {
-		return vector<string>();
-	}
-
 	const PopulationPtr& GetPopulation() const;
 	const SessionPtr& GetSession() const;
 
+	template <class T>
+	static void CollectCheckpointables(vector<CheckpointablePtr>& pList, const Operator<T>& pOp) {
+		auto checkpointable = dynamic_pointer_cast<Checkpointable>(pOp.Get());
+		if (checkpointable)
+			pList.push_back(checkpointable);
+	}
+	template <class T>
+	static void CollectCheckpointables(vector<CheckpointablePtr>& pList, const OperatorGroup<T>& pGroup) {
+		for (uint i = 0; i < pGroup.GetSize(); i++) {
+			auto checkpointable = dynamic_pointer_cast<Checkpointable>(pGroup.Get(i));
+			if (checkpointable)
+				pList.push_back(checkpointable);
+		}
+	}
+
 	// Set and get pool functions
 	void SetPool(uint pIndex, const PoolPtr& pPool);
 	template <class T>
@@ -60,43 +76,45 @@ protected:
 	OrganismPoolPtr GetOrganismPool(uint pIndex);
 
 	template<class ReturnT, class... Args>
-	ReturnT Execute(string pId, function<ReturnT(Args&&...)> pFunc, Args&&... args) {
+	ReturnT Execute(const Phase& pPhase, function<ReturnT(Args&&...)> pFunc, Args&&... args) {
 		EA_LOG_TRACE << "Gen " << GetPopulation()->GetGeneration()
-				<< ", function \"" << pId << "\"" << flush;
-		return mSession->Measure(pId, pFunc, forward<Args>(args)...);
+				<< ", function \"" << pPhase.GetName() << "\"" << flush;
+		return mSession->Measure(pPhase, [&] () {
+			return pFunc(forward<Args>(args)...);
+		});
 	}
 	template<class OpT, class... Args>
-	typename OpT::OutputType Execute(string pId, const Operator<OpT>& pOp, Args&&... args) {
+	typename OpT::OutputType Execute(const Phase& pPhase, const Operator<OpT>& pOp, Args&&... args) {
 		EA_LOG_TRACE << "Gen " << GetPopulation()->GetGeneration()
-				<< ", operator \"" << pId << "\"" << flush;
+				<< ", operator \"" << pPhase.GetName() << "\"" << flush;
 
-		return mSession->Measure(pId, function<typename OpT::OutputType(void)>([&] () {
+		return mSession->Measure(pPhase, [&] () {
 			return pOp(mSession, forward<Args>(args)...);
-		}));
+		});
 	}
 
 	template<class OpT, class... Args>
-	typename OperatorGroup<OpT>::ReturnType ExecuteInParallel(string pId,
+	typename OperatorGroup<OpT>::ReturnType ExecuteInParallel(const Phase& pPhase,
 			const OperatorGroup<OpT>& pGroup, Args&&... args) {
 
 		EA_LOG_TRACE << "Gen " << GetPopulation()->GetGeneration()
-				<< ", operator group \"" << pId << "\" in parallel" << flush;
+				<< ", operator group \"" << pPhase.GetName() << "\" in parallel" << flush;
 
-		return mSession->Measure(pId, function<typename OperatorGroup<OpT>::ReturnType(void)>([&] () {
+		return mSession->Measure(pPhase, [&] () {
 			return pGroup.InParallel(mSession, forward<Args>(args)...);
-		}));
+		});
 	}
 
 	template<class OpT, class... Args>
-	typename OpT::OutputType ExecuteInSeries(string pId, const SeriesOperatorGroup<OpT>& pGroup,
+	typename OpT::OutputType ExecuteInSeries(const Phase& pPhase, const SeriesOperatorGroup<OpT>& pGroup,
 			typename SeriesOperatorGroup<OpT>::ProcessingType pData, Args&&... args) {
 
 		EA_LOG_TRACE << "Gen " << GetPopulation()->GetGeneration()
-				<< ", operator group \"" << pId << "\" in series" << flush;
+				<< ", operator group \"" << pPhase.GetName() << "\" in series" << flush;
 
-		return mSession->Measure(pId, function<typename OpT::OutputType(void)>([&] () {
+		return mSession->Measure(pPhase, [&] () {
  			return pGroup.InSeries(mSession, pData, forward<Args>(args)...);
-		}));
+		});
 	}
 
 private:
@@ -0,0 +1,45 @@
+/*
+ * CheckpointPool.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../../pch.h"
+#include "CheckpointPool.h"
+
+namespace ea {
+
+/**
+ * @class CheckpointPool
+ * Pool which stores the state of random generators and Checkpointable components.
+ * Each entry maps an identifier to the binary state of a component.
+ * It is captured by Checkpoint and written by BackupHook as a separate record of the back-up file,
+ * outside the Pool of the Population.
+ *
+ * @see Checkpoint
+ */
+
+CheckpointPool::CheckpointPool() : map<string, string>() {
+}
+
+CheckpointPool::~CheckpointPool() {
+}
+
+/**
+ * Create a copy of this CheckpointPool.
+ * @return The copy of this CheckpointPool.
+ */
+PoolPtr CheckpointPool::Clone() const {
+	return make_shared<CheckpointPool>(*this);
+}
+
+void CheckpointPool::DoSerialize(ostream& pStream) const {
+	Write<map<string, string>>(pStream, *this);
+}
+
+void CheckpointPool::DoDeserialize(istream& pStream) {
+	Read(pStream, static_cast<map<string, string>&>(*this));
+}
+
+} /* namespace ea */
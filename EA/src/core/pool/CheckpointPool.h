@@ -0,0 +1,32 @@
+/*
+ * CheckpointPool.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../../EA/Type/Core.h"
+#include "Pool.h"
+#include "../../rtoc/Constructible.h"
+
+namespace ea {
+
+using namespace std;
+
+class CheckpointPool : public Pool, public map<string, string> {
+public:
+	EA_TYPEINFO_DEFAULT(CheckpointPool)
+
+	CheckpointPool();
+	virtual ~CheckpointPool();
+
+	virtual PoolPtr Clone() const override;
+
+protected:
+	virtual void DoSerialize(ostream& pStream) const override;
+	virtual void DoDeserialize(istream& pStream) override;
+};
+
+} /* namespace ea */
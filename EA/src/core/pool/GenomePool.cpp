@@ -66,8 +66,17 @@ GenomePoolPtr GenomePool::Join(vector<GenomePoolPtr> pPools) {
 	return aggregated;
 }
 
+/**
+ * Create a copy of this GenomePool.
+ * The Genome objects are shared between the two pools.
+ * @return The copy of this GenomePool.
+ */
+PoolPtr GenomePool::Clone() const {
+	return make_shared<GenomePool>(*this);
+}
+
 void GenomePool::DoSerialize(ostream& pStream) const {
-	Write(pStream, vector<GenomePtr>(*this));
+	Write<vector<GenomePtr>>(pStream, *this);
 }
 
 void GenomePool::DoDeserialize(istream& pStream) {
@@ -35,6 +35,8 @@ public:
 	inline virtual ~GenomePool() {
 	}
 
+	virtual PoolPtr Clone() const override;
+
 	void Shuffle();
 
 	static GenomePoolPtr Join(vector<GenomePoolPtr> pPools);
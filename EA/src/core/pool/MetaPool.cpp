@@ -24,6 +24,18 @@ MetaPool::MetaPool() : map<uint, PoolPtr>() {
 MetaPool::~MetaPool() {
 }
 
+/**
+ * Create a copy of this MetaPool.
+ * The child pools are also cloned.
+ * @return The copy of this MetaPool.
+ */
+PoolPtr MetaPool::Clone() const {
+	MetaPoolPtr copy = make_shared<MetaPool>();
+	for (auto& pool : *this)
+		copy->emplace(pool.first, pool.second ? pool.second->Clone() : nullptr);
+	return copy;
+}
+
 void MetaPool::DoSerialize(ostream& pStream) const {
 	Write(pStream, map<uint, PoolPtr>(*this));
 }
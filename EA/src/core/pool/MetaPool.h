@@ -22,6 +22,8 @@ public:
 	MetaPool();
 	virtual ~MetaPool();
 
+	virtual PoolPtr Clone() const override;
+
 protected:
 	virtual void DoSerialize(ostream& pStream) const override;
 	virtual void DoDeserialize(istream& pStream) override;
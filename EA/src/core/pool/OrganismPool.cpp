@@ -92,8 +92,17 @@ OrganismPoolPtr ea::OrganismPool::Join(vector<OrganismPoolPtr> pPools) {
 	return aggregated;
 }
 
+/**
+ * Create a copy of this OrganismPool.
+ * The Organism objects are shared between the two pools.
+ * @return The copy of this OrganismPool.
+ */
+PoolPtr OrganismPool::Clone() const {
+	return make_shared<OrganismPool>(*this);
+}
+
 void OrganismPool::DoSerialize(ostream& pStream) const {
-	Write(pStream, vector<OrganismPtr>(*this));
+	Write<vector<OrganismPtr>>(pStream, *this);
 }
 
 void OrganismPool::DoDeserialize(istream& pStream) {
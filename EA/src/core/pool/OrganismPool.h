@@ -34,6 +34,8 @@ public:
 	inline virtual ~OrganismPool() {
 	}
 
+	virtual PoolPtr Clone() const override;
+
 	void Sort();
 	void Shuffle();
 
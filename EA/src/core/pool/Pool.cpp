@@ -9,6 +9,9 @@
 #include "../../Common.h"
 #include "GenomePool.h"
 #include "OrganismPool.h"
+#include "../../rtoc/NameService.h"
+#include <mutex>
+#include <typeindex>
 
 namespace ea {
 
@@ -22,7 +25,37 @@ namespace ea {
  * @see OrganismPool
  */
 
+#ifndef DOXYGEN_IGNORE
+// GetTypeInfo() builds a new TypeInfo on each call, so it is only called once per Pool class
+static const TypeInfo& GetCachedTypeInfo(const Pool& pPool) {
+	static mutex sMutex;
+	static HashMap<type_index, TypeInfo> sTypes;
+
+	lock_guard<mutex> lock(sMutex);
+	auto entry = sTypes.find(typeid(pPool));
+	if (entry == sTypes.end())
+		entry = sTypes.emplace(typeid(pPool), const_cast<Pool&>(pPool).GetTypeInfo()).first;
+	return entry->second;
+}
+#endif
+
 Pool::~Pool() {
 }
 
+/**
+ * Create a copy of this Pool.
+ * The copy is independent from this Pool (adding or removing elements does not affect the original),
+ * but the elements themselves (e.g. Genome or Organism) may be shared.
+ * The default implementation serializes and deserializes the Pool in memory.
+ * @return The copy of this Pool.
+ */
+PoolPtr Pool::Clone() const {
+	PoolPtr copy = dynamic_pointer_cast<Pool>(GetCachedTypeInfo(*this).ConstructDefault());
+
+	stringstream ss;
+	Serialize(ss);
+	copy->Deserialize(ss);
+	return copy;
+}
+
 } /* namespace ea */
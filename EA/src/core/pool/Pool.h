@@ -15,6 +15,8 @@ namespace ea {
 class Pool : public Storable {
 public:
 	virtual ~Pool();
+
+	virtual PoolPtr Clone() const;
 };
 
 } /* namespace ea */
@@ -69,6 +69,7 @@ OrganismPtr IndividualEvaluator::Evaluate(const GenomePtr& pGenome) {
  * @return The Fitness value corresponding to the input Genome.
  */
 FitnessPtr IndividualEvaluator::EvaluateFitness(const GenomePtr& pGenome) {
+	Tracer::Scope trace("Evaluate", "evaluation");
 	try {
 		return this->DoEvaluate(pGenome);
 	} catch (exception& e) {
@@ -0,0 +1,84 @@
+/*
+ * NullEvaluator.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../pch.h"
+#include "NullEvaluator.h"
+
+namespace ea {
+
+/**
+ * @class NullEvaluator
+ * A ScalarEvaluator which does not look at the Genome and costs almost nothing.
+ * Each evaluation returns the next value of a pseudo-random sequence in [0, 1) determined by the seed,
+ * so the selection still has fitness values to work with.
+ *
+ * Replacing the evaluator of a configuration by a NullEvaluator measures the cost of the framework itself
+ * (variation, cloning, pools, selection and hooks), which is the upper bound of the throughput achievable
+ * for that configuration. See the @tt{-z} option of @tt{openea run}.
+ *
+ * In multi-threading, the same values are produced but they may be assigned to different genomes.
+ *
+ * @name{NullEvaluator}
+ *
+ * @eaml
+ * @attr{maximizer, bool - Optional - Whether the produced ScalarFitness is maximized (default is true).}
+ * @attr{seed, ullong - Optional - The seed of the fitness sequence (default is 0).}
+ * @endeaml
+ */
+
+EA_TYPEINFO_CUSTOM_IMPL(NullEvaluator) {
+	return *ea::TypeInfo("NullEvaluator")
+		.Add("maximizer", &NullEvaluator::mMaximizer)
+		->Add("seed", &NullEvaluator::mSeed)
+		->SetConstructor<NullEvaluator>();
+}
+
+/**
+ * Create a NullEvaluator.
+ * @param pMaximizer Whether the produced ScalarFitness is maximized.
+ * @param pSeed The seed of the fitness sequence.
+ */
+NullEvaluator::NullEvaluator(bool pMaximizer, ullong pSeed) : mMaximizer(pMaximizer), mSeed(pSeed), mCounter(0) {
+}
+
+NullEvaluator::~NullEvaluator() {
+}
+
+/**
+ * Whether the produced ScalarFitness is maximized.
+ * @return true if this NullEvaluator is a maximizer.
+ */
+bool NullEvaluator::IsMaximizer() {
+	return mMaximizer;
+}
+
+/**
+ * Set whether the produced ScalarFitness is maximized.
+ * @param pMaximizer true for a maximizer, false for a minimizer.
+ */
+void NullEvaluator::SetMaximizer(bool pMaximizer) {
+	mMaximizer = pMaximizer;
+}
+
+/**
+ * Get the seed of the fitness sequence.
+ * @return The seed.
+ */
+ullong NullEvaluator::GetSeed() const {
+	return mSeed;
+}
+
+double NullEvaluator::DoScalarEvaluate(const GenomePtr& pGenome) {
+	// SplitMix64 of the evaluation index
+	ullong x = mSeed + (mCounter.fetch_add(1, memory_order_relaxed) + 1) * 0x9E3779B97F4A7C15ull;
+	x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+	x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+	x ^= x >> 31;
+	return (x >> 11) / 9007199254740992.0;
+}
+
+} /* namespace ea */
@@ -0,0 +1,36 @@
+/*
+ * NullEvaluator.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../EA/Type/Core.h"
+#include "ScalarEvaluator.h"
+#include <atomic>
+
+namespace ea {
+
+class NullEvaluator : public ScalarEvaluator {
+public:
+	EA_TYPEINFO_CUSTOM_DECL
+
+	NullEvaluator(bool pMaximizer = true, ullong pSeed = 0);
+	virtual ~NullEvaluator();
+
+	virtual bool IsMaximizer() override;
+	void SetMaximizer(bool pMaximizer);
+	ullong GetSeed() const;
+
+protected:
+	virtual double DoScalarEvaluate(const GenomePtr& pGenome) override;
+
+private:
+	bool mMaximizer;
+	ullong mSeed;
+	atomic<ullong> mCounter;
+};
+
+} /* namespace ea */
@@ -77,6 +77,10 @@ int ScalarFitness::Compare(const Fitness& other) const {
 		return ((this->mValue > casted->mValue) ^ mMaximizer) ? -1 : 1;
 }
 
+size_t ScalarFitness::GetMemoryUsage() const {
+	return sizeof(ScalarFitness);
+}
+
 inline void ScalarFitness::DoSerialize(ostream& pStream) const {
 	Write<bool>(pStream, mMaximizer);
 	Write<double>(pStream, mValue);
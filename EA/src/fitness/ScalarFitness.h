@@ -28,6 +28,7 @@ public:
 	bool IsMaximizer() const;
 
 	virtual int Compare(const Fitness& other) const;
+	virtual size_t GetMemoryUsage() const override;
 
 protected:
 	inline virtual void DoSerialize(ostream& pStream) const override;
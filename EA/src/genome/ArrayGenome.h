@@ -69,6 +69,13 @@ public:
 	inline GenomeType& GetGenes() {
 		return mGenes;
 	}
+	/**
+	 * Get the heap memory allocated by the array of genes.
+	 * @return The capacity of the array in bytes.
+	 */
+	inline size_t GetGenesMemoryUsage() const {
+		return is_same<T, bool>::value ? (mGenes.capacity() + 7) / 8 : mGenes.capacity() * sizeof(T);
+	}
 
 protected:
 	inline virtual void DoSerialize(ostream& pStream) const override {
@@ -138,6 +145,10 @@ public:
 		os << "<ArrayGenome>";
 		return os;
 	}
+
+	inline virtual size_t GetMemoryUsage() const override {
+		return sizeof(ArrayGenome<T>) + this->GetGenesMemoryUsage();
+	}
 };
 
 #ifndef DOXYGEN_IGNORE
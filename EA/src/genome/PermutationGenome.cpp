@@ -85,5 +85,9 @@ ostream& PermutationGenome::Print(ostream& os) const {
 	return os;
 }
 
+size_t PermutationGenome::GetMemoryUsage() const {
+	return sizeof(PermutationGenome) + GetGenesMemoryUsage();
+}
+
 }
 /* namespace ea */
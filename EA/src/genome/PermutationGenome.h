@@ -23,6 +23,7 @@ public:
 	bool IsValid() const;
 
 	virtual ostream& Print(ostream& os) const override;
+	virtual size_t GetMemoryUsage() const override;
 };
 
 } /* namespace ea */
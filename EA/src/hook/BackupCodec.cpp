@@ -0,0 +1,109 @@
+/*
+ * BackupCodec.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../pch.h"
+#include "BackupCodec.h"
+#include <boost/iostreams/filter/zlib.hpp>
+#include <mutex>
+
+namespace ea {
+
+/**
+ * @class BackupCodec
+ * The interface for compression methods of back-up files.
+ * A BackupCodec adds its encoding and decoding filters to a boost::iostreams filtering stream.
+ * BackupHook uses the encoder when writing back-up files, the name of the codec is stored in the header of the file
+ * so Restore can pick the matching decoder.
+ *
+ * Built-in codecs are "none" (no compression) and "zlib".
+ * Users can register their own codec with Add(), it must be registered before writing or restoring a back-up.
+ *
+ * @see BackupHook
+ * @see Restore
+ */
+
+#ifndef DOXYGEN_IGNORE
+class NoneBackupCodec : public BackupCodec {
+public:
+	virtual void PushEncoder(boost::iostreams::filtering_ostream& pStream) const override {
+	}
+	virtual void PushDecoder(boost::iostreams::filtering_istream& pStream) const override {
+	}
+};
+
+class ZlibBackupCodec : public BackupCodec {
+public:
+	virtual void PushEncoder(boost::iostreams::filtering_ostream& pStream) const override {
+		pStream.push(boost::iostreams::zlib_compressor(boost::iostreams::zlib::best_speed));
+	}
+	virtual void PushDecoder(boost::iostreams::filtering_istream& pStream) const override {
+		pStream.push(boost::iostreams::zlib_decompressor());
+	}
+};
+
+static mutex sMutex;
+#endif
+
+/**
+ * The name of the codec which does not compress the data.
+ */
+const string BackupCodec::NONE = "none";
+/**
+ * The name of the zlib codec.
+ */
+const string BackupCodec::ZLIB = "zlib";
+
+BackupCodec::~BackupCodec() {
+}
+
+/**
+ * @fn void BackupCodec::PushEncoder(boost::iostreams::filtering_ostream& pStream) const
+ * Push the encoding filters to the output stream.
+ * @param pStream The output filtering stream (before any device is pushed).
+ */
+
+/**
+ * @fn void BackupCodec::PushDecoder(boost::iostreams::filtering_istream& pStream) const
+ * Push the decoding filters to the input stream.
+ * @param pStream The input filtering stream (before any device is pushed).
+ */
+
+/**
+ * Register a new codec.
+ * If a codec with the same name exists, it will be replaced.
+ * @param pName The name of the codec (stored in back-up files).
+ * @param pCodec The codec object.
+ */
+void BackupCodec::Add(string pName, const BackupCodecPtr& pCodec) {
+	lock_guard<mutex> lock(sMutex);
+	GetMap()[pName] = pCodec;
+}
+
+/**
+ * Get the codec with the given name.
+ * @param pName The name of the codec.
+ * @return The codec object. If the name is not registered, an exception will be thrown.
+ */
+BackupCodecPtr BackupCodec::Get(string pName) {
+	lock_guard<mutex> lock(sMutex);
+	auto& map = GetMap();
+	auto itr = map.find(pName);
+	if (itr == map.end())
+		throw EA_EXCEPTION(EAException, FILE_FEATURE_NOT_SUPPORT,
+				"BackupCodec::Get: Codec \"" + pName + "\" is not registered.");
+	return itr->second;
+}
+
+HashMap<string, BackupCodecPtr>& BackupCodec::GetMap() {
+	static HashMap<string, BackupCodecPtr> sMap = {
+		{ NONE, make_shared<NoneBackupCodec>() },
+		{ ZLIB, make_shared<ZlibBackupCodec>() }
+	};
+	return sMap;
+}
+
+} /* namespace ea */
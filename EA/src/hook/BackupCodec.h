@@ -0,0 +1,34 @@
+/*
+ * BackupCodec.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../EA/Type/Utility.h"
+#include <boost/iostreams/filtering_stream.hpp>
+
+namespace ea {
+
+using namespace std;
+
+class BackupCodec {
+public:
+	virtual ~BackupCodec();
+
+	virtual void PushEncoder(boost::iostreams::filtering_ostream& pStream) const = 0;
+	virtual void PushDecoder(boost::iostreams::filtering_istream& pStream) const = 0;
+
+	static void Add(string pName, const BackupCodecPtr& pCodec);
+	static BackupCodecPtr Get(string pName);
+
+	static const string NONE;
+	static const string ZLIB;
+
+private:
+	static HashMap<string, BackupCodecPtr>& GetMap();
+};
+
+} /* namespace ea */
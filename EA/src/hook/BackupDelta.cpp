@@ -0,0 +1,147 @@
+/*
+ * BackupDelta.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../pch.h"
+#include "BackupDelta.h"
+#include "../core/Population.h"
+#include "../core/pool/OrganismPool.h"
+#include "../core/pool/GenomePool.h"
+#include "../rtoc/BinarySerializer.h"
+
+namespace ea {
+
+/**
+ * @class BackupDelta
+ * Encoder and decoder of incremental back-ups.
+ * A delta records the difference between a Population and a previous checkpoint (the base) of the same run.
+ * All counters are stored. For OrganismPool and GenomePool, each element is stored either as a reference
+ * to an element of the same pool in the base (if the very same object is still there) or in full.
+ * Other kinds of Pool are always stored in full.
+ *
+ * In PLUS-mode strategies most survivors are kept between generations, so a delta is usually much smaller
+ * than a full back-up. BackupHook writes deltas between full back-ups, Restore replays them.
+ *
+ * @see BackupHook
+ * @see Restore
+ */
+
+#ifndef DOXYGEN_IGNORE
+template<class P>
+static void WritePoolDelta(ostream& pStream, const P& pPool, const P& pBase) {
+	HashMap<const void*, uint> baseIndex;
+	baseIndex.reserve(pBase.size());
+	for (uint i = 0; i < pBase.size(); i++)
+		baseIndex.emplace(pBase[i].get(), i + 1);
+
+	BinarySerializer<uint>::Write(pStream, pPool.size());
+	for (auto& elem : pPool) {
+		auto itr = baseIndex.find(elem.get());
+		if (itr != baseIndex.end())
+			BinarySerializer<uint>::Write(pStream, itr->second);
+		else {
+			BinarySerializer<uint>::Write(pStream, 0);
+			BinarySerializer<typename P::value_type>::Write(pStream, elem);
+		}
+	}
+}
+
+template<class P>
+static Ptr<P> ReadPoolDelta(istream& pStream, const Ptr<P>& pBase) {
+	Ptr<P> pool = make_shared<P>(BinarySerializer<uint>::Read(pStream));
+	for (auto& elem : *pool) {
+		uint ref = BinarySerializer<uint>::Read(pStream);
+		if (ref == 0)
+			elem = BinarySerializer<typename P::value_type>::Read(pStream);
+		else if (pBase && ref <= pBase->size())
+			elem = (*pBase)[ref - 1];
+		else
+			throw EA_EXCEPTION(EAException, WRONG_FILE_FORMAT,
+					"BackupDelta::Read: Reference to an element which does not exist in the base back-up.");
+	}
+	return pool;
+}
+#endif
+
+/**
+ * Write the difference between a Population and its base to a stream.
+ * Both Population must stay unchanged during the call (use Population::Snapshot()).
+ * @param pStream The output stream.
+ * @param pPopulation The Population to be written.
+ * @param pBase The previous checkpoint which the delta refers to.
+ */
+void BackupDelta::Write(ostream& pStream, const PopulationPtr& pPopulation, const PopulationPtr& pBase) {
+	BinarySerializer<Population::CounterMap>::Write(pStream, pPopulation->GetCounters());
+
+	auto& pools = pPopulation->GetPools();
+	BinarySerializer<uint>::Write(pStream, pools.size());
+	for (auto& entry : pools) {
+		BinarySerializer<uint>::Write(pStream, entry.first);
+		const PoolPtr& pool = entry.second;
+		PoolPtr base = pBase->GetPool(entry.first);
+
+		auto organismPool = dynamic_pointer_cast<OrganismPool>(pool);
+		auto organismBase = dynamic_pointer_cast<OrganismPool>(base);
+		auto genomePool = dynamic_pointer_cast<GenomePool>(pool);
+		auto genomeBase = dynamic_pointer_cast<GenomePool>(base);
+
+		if (!pool)
+			BinarySerializer<unsigned char>::Write(pStream, EMPTY_POOL);
+		else if (organismPool && organismBase) {
+			BinarySerializer<unsigned char>::Write(pStream, ORGANISM_POOL_DELTA);
+			WritePoolDelta(pStream, *organismPool, *organismBase);
+		} else if (genomePool && genomeBase) {
+			BinarySerializer<unsigned char>::Write(pStream, GENOME_POOL_DELTA);
+			WritePoolDelta(pStream, *genomePool, *genomeBase);
+		} else {
+			BinarySerializer<unsigned char>::Write(pStream, FULL_POOL);
+			BinarySerializer<PoolPtr>::Write(pStream, pool);
+		}
+	}
+}
+
+/**
+ * Read a delta from a stream and apply it on its base.
+ * @param pStream The input stream.
+ * @param pBase The Population restored from the base checkpoint (it is not modified).
+ * @return The restored Population.
+ */
+PopulationPtr BackupDelta::Read(istream& pStream, const PopulationPtr& pBase) {
+	PopulationPtr population = make_shared<Population>();
+
+	Population::CounterMap counters;
+	BinarySerializer<Population::CounterMap>::Read(pStream, counters);
+	for (auto& counter : counters)
+		population->SetCounter(counter.first, counter.second);
+
+	uint poolCount = BinarySerializer<uint>::Read(pStream);
+	for (uint i = 0; i < poolCount; i++) {
+		uint index = BinarySerializer<uint>::Read(pStream);
+		PoolPtr base = pBase->GetPool(index);
+
+		switch (BinarySerializer<unsigned char>::Read(pStream)) {
+		case EMPTY_POOL:
+			population->SetPool(index, PoolPtr());
+			break;
+		case FULL_POOL:
+			population->SetPool(index, BinarySerializer<PoolPtr>::Read(pStream));
+			break;
+		case ORGANISM_POOL_DELTA:
+			population->SetPool(index, ReadPoolDelta(pStream, dynamic_pointer_cast<OrganismPool>(base)));
+			break;
+		case GENOME_POOL_DELTA:
+			population->SetPool(index, ReadPoolDelta(pStream, dynamic_pointer_cast<GenomePool>(base)));
+			break;
+		default:
+			throw EA_EXCEPTION(EAException, WRONG_FILE_FORMAT,
+					"BackupDelta::Read: Unknown pool record.");
+		}
+	}
+
+	return population;
+}
+
+} /* namespace ea */
@@ -0,0 +1,30 @@
+/*
+ * BackupDelta.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../EA/Type/Core.h"
+
+namespace ea {
+
+using namespace std;
+
+class BackupDelta {
+public:
+	static void Write(ostream& pStream, const PopulationPtr& pPopulation, const PopulationPtr& pBase);
+	static PopulationPtr Read(istream& pStream, const PopulationPtr& pBase);
+
+private:
+	enum PoolMode : unsigned char {
+		EMPTY_POOL,
+		FULL_POOL,
+		ORGANISM_POOL_DELTA,
+		GENOME_POOL_DELTA
+	};
+};
+
+} /* namespace ea */
@@ -12,6 +12,15 @@
 #include "../core/pool/OrganismPool.h"
 #include "../rtoc/BinarySerializer.h"
 #include "../core/Population.h"
+#include "../core/Session.h"
+#include "../rtoc/TypeDictionary.h"
+#include "BackupCodec.h"
+#include "BackupDelta.h"
+#include "BackupIndex.h"
+#include "../core/pool/CheckpointPool.h"
+#include "../utility/Checkpoint.h"
+#include <fcntl.h>
+#include <unistd.h>
 
 namespace ea {
 
@@ -28,6 +37,31 @@ using boost::format;
  * Back-up files will be saved in a provided folder. The name of the files will be \<generation_number\>.eabak.
  * Old back-up file with the same generation number will be overwritten.
  *
+ * By default, the Population is snapshotted on the evolution thread (see Population::Snapshot())
+ * and then serialized, compressed and written on a background thread, so the evolution does not wait for the disk.
+ * Only one back-up is written at a time; the next back-up (and the end of evolution) waits for the previous one.
+ * Each file is first written to \<name\>.eabak.tmp and then renamed, so an interrupted write never leaves
+ * a truncated .eabak file behind. The sync policy decides whether the data is flushed to disk before renaming.
+ *
+ * To reduce I/O when back-ups are frequent, the Hook can write incremental back-ups (see BackupDelta)
+ * which only store the changes since the previous back-up. The full-interval attribute sets how often a full
+ * back-up is written: with a full interval of N, each full back-up is followed by up to N - 1 deltas.
+ * Restore replays the chain from the last full back-up, so the files of the chain must be kept together.
+ *
+ * Full back-ups can also be indexed (see BackupIndex): the offset of every pool and organism is stored at the end
+ * of the file, so BackupReader can memory-map the file, load single pools or the best organisms only,
+ * and decode large Population in parallel. Indexed back-ups cannot be compressed.
+ *
+ * A back-up file starts with the 4-byte magic "EABK", the format version, a byte order mark,
+ * the name of the BackupCodec, the kind of back-up (full, delta with the generation of its base, or indexed)
+ * and the checkpoint record, followed by the (encoded) Population, delta or index.
+ * Arrays of primitive values (e.g. genes of ArrayGenome) are stored as raw memory in the byte order of the writer,
+ * so a back-up can only be restored on a machine with the same byte order.
+ * Class names are stored once per file using a TypeDictionary.
+ * The state of the random generator and of Checkpointable operators is captured before each back-up
+ * and stored in the checkpoint record (see Checkpoint), so a restored run continues with the same random sequence.
+ * Files written by older versions (without the header) can still be read by Restore.
+ *
  * @name{BackupHook}
  *
  * @eaml
@@ -35,13 +69,73 @@ using boost::format;
  * @attr{frequency, uint - Optional - The interval of generations between two back-up files.}
  * @attr{clear, bool - Optional - If true\, all files in the given directory
  * will be cleared before writing any back-up file (default is false).}
+ * @attr{async, bool - Optional - If true\, back-up files are written on a background thread (default is true).}
+ * @attr{codec, string - Optional - The name of the BackupCodec used to compress the files
+ * (\tt{"none"} or \tt{"zlib"}\, default is \tt{"none"}).}
+ * @attr{sync, SyncPolicy - Optional - Whether the files are flushed to disk (default is \tt{"none"}).}
+ * @attr{full-interval, uint - Optional - Number of back-ups between two full back-ups\,
+ * others are written as deltas (default is 1\, i.e. all back-ups are full).}
+ * @attr{indexed, bool - Optional - If true\, full back-ups are written with an index (default is false).}
  * @endeaml
  */
 
+#ifndef DOXYGEN_IGNORE
+EA_DEFINE_CUSTOM_SERIALIZER(BackupHook::SyncPolicy, data, ss) {
+	static HashMap<string, BackupHook::SyncPolicy> strToPolicy = {
+		{"none", BackupHook::SYNC_NONE},
+		{"file", BackupHook::SYNC_FILE},
+		{"all",  BackupHook::SYNC_ALL}
+	};
+
+	string str;
+	if (!bool(ss >> str))
+		return false;
+
+	auto itr = strToPolicy.find(str);
+	if (itr == strToPolicy.end())
+		return false;
+
+	data = itr->second;
+	return true;
+}
+
+static void SyncPath(const boost::filesystem::path& pPath) {
+	int fd = open(pPath.c_str(), O_RDONLY);
+	if (fd < 0)
+		throw EA_EXCEPTION(EAException, CANNOT_CREATE_FILE,
+				"BackupHook: Cannot open \"" + pPath.string() + "\" to synchronize.");
+	int result = fsync(fd);
+	close(fd);
+	if (result != 0)
+		throw EA_EXCEPTION(EAException, CANNOT_CREATE_FILE,
+				"BackupHook: Cannot synchronize \"" + pPath.string() + "\" to disk.");
+}
+#endif
+
+/**
+ * The magic bytes at the beginning of every back-up file.
+ */
+const char BackupHook::sMagic[4] = { 'E', 'A', 'B', 'K' };
+
+/**
+ * The current version of the back-up file format.
+ */
+const uint BackupHook::sVersion = 6;
+
+/**
+ * The byte order mark written after the version (since version 2).
+ */
+const uint BackupHook::sByteOrder = 0x01020304;
+
 EA_TYPEINFO_CUSTOM_IMPL(BackupHook)  {
 	return *ea::TypeInfo("BackupHook")
 		.Add("frequency", &BackupHook::mFrequency)
 		->Add("clear", &BackupHook::mClear)
+		->Add("async", &BackupHook::mAsync)
+		->Add("codec", &BackupHook::mCodec)
+		->Add("sync", &BackupHook::mSyncPolicy)
+		->Add("full-interval", &BackupHook::mFullInterval)
+		->Add("indexed", &BackupHook::mIndexed)
 		->SetConstructor<BackupHook, string>("dir");
 }
 
@@ -54,10 +148,14 @@ EA_TYPEINFO_CUSTOM_IMPL(BackupHook)  {
  *
  */
 BackupHook::BackupHook(string pDir, uint pFrequency, bool pClear) :
-		mDir(pDir), mFrequency(pFrequency), mClear(pClear) {
+		mDir(pDir), mFrequency(pFrequency), mClear(pClear),
+		mAsync(true), mCodec(BackupCodec::NONE), mSyncPolicy(SYNC_NONE), mFullInterval(1), mIndexed(false),
+		mDeltaCount(0), mLastSnapshot(), mWorker(), mWorkerError() {
 }
 
 BackupHook::~BackupHook() {
+	if (mWorker.joinable())
+		mWorker.join();
 }
 
 void BackupHook::DoInitial() {
@@ -100,6 +198,7 @@ void BackupHook::DoGenerational() {
 
 void BackupHook::DoEnd() {
 	CreateBackup();
+	WaitForBackup();
 }
 
 long long BackupHook::ExtractGenerationNumber(string pFilename) {
@@ -117,15 +216,180 @@ long long BackupHook::ExtractGenerationNumber(string pFilename) {
 }
 
 void BackupHook::CreateBackup() {
+	WaitForBackup();
+
 	ullong generation = GetGeneration();
 	boost::filesystem::path file(mDir);
 	file /= (format("%06llu.eabak") % generation).str();
 
-	ofstream ofs(file.string(), ios::binary);
-	BinarySerializer<PopulationPtr>::Write(ofs, GetPopulation());
+	PopulationPtr base;
+	if (mLastSnapshot && mDeltaCount + 1 < mFullInterval && mLastSnapshot->GetGeneration() < generation) {
+		base = mLastSnapshot;
+		mDeltaCount++;
+	} else
+		mDeltaCount = 0;
+
+	CheckpointPoolPtr checkpoint = Checkpoint::Capture(GetSession()->GetStrategy());
+
+	bool keepSnapshot = mFullInterval > 1;
+	PopulationPtr population = mAsync || keepSnapshot ? GetPopulation()->Snapshot() : GetPopulation();
+	mLastSnapshot = keepSnapshot ? population : nullptr;
+
+	if (mAsync) {
+		mWorker = thread([this, file, population, base, checkpoint]() {
+			try {
+				WriteFile(file.string(), population, base, checkpoint);
+			} catch (...) {
+				mWorkerError = current_exception();
+			}
+		});
+	} else
+		WriteFile(file.string(), population, base, checkpoint);
+}
+
+void BackupHook::WriteFile(string pFilename, const PopulationPtr& pPopulation, const PopulationPtr& pBase,
+		const CheckpointPoolPtr& pCheckpoint) {
+	using namespace boost::filesystem;
+
+	path file(pFilename);
+	path temp(pFilename + ".tmp");
+	{
+		std::ofstream ofs(temp.string(), ios::binary);
+		if (!ofs)
+			throw EA_EXCEPTION(EAException, CANNOT_CREATE_FILE,
+					"BackupHook: Cannot create \"" + temp.string() + "\".");
+		WriteBackup(ofs, pPopulation, mCodec, pBase, mIndexed, pCheckpoint);
+		ofs.close();
+		if (!ofs)
+			throw EA_EXCEPTION(EAException, CANNOT_CREATE_FILE,
+					"BackupHook: Cannot write to \"" + temp.string() + "\".");
+	}
+
+	if (mSyncPolicy != SYNC_NONE)
+		SyncPath(temp);
+	rename(temp, file);
+	if (mSyncPolicy == SYNC_ALL)
+		SyncPath(file.parent_path());
+
 	EA_LOG_DEBUG<<"BackupHook: Backup saved to \"" << file.string() << "\"." << flush;
 }
 
+void BackupHook::WaitForBackup() {
+	if (mWorker.joinable())
+		mWorker.join();
+
+	if (mWorkerError) {
+		exception_ptr error = mWorkerError;
+		mWorkerError = nullptr;
+		mLastSnapshot = nullptr;
+		rethrow_exception(error);
+	}
+}
+
+/**
+ * Write a back-up of the given Population to a stream.
+ * The header (magic, version, byte order mark, codec name, kind and checkpoint) is written first,
+ * then the Population (or its delta) is serialized with a TypeDictionary and encoded by the codec.
+ * The output can be read back by Restore::FromStream().
+ * @param pStream The output stream.
+ * @param pPopulation The Population to be backed up.
+ * @param pCodec The name of the BackupCodec used to encode the Population.
+ * @param pBase If not null, only the difference from this earlier snapshot is written (see BackupDelta).
+ * @param pIndexed If true and pBase is null, the back-up is written with an index (see BackupIndex).
+ * The codec must be "none" in this case.
+ * @param pCheckpoint The state captured by Checkpoint::Capture() (can be nullptr).
+ */
+void BackupHook::WriteBackup(ostream& pStream, const PopulationPtr& pPopulation, string pCodec,
+		const PopulationPtr& pBase, bool pIndexed, const CheckpointPoolPtr& pCheckpoint) {
+	BackupCodecPtr codec = BackupCodec::Get(pCodec);
+	bool indexed = pIndexed && !pBase;
+	if (indexed && pCodec != BackupCodec::NONE)
+		throw EA_EXCEPTION(EAException, FILE_FEATURE_NOT_SUPPORT,
+				"BackupHook::WriteBackup: Indexed back-ups cannot be compressed.");
+
+	pStream.write(sMagic, sizeof(sMagic));
+	BinarySerializer<uint>::Write(pStream, sVersion);
+	BinarySerializer<uint>::Write(pStream, sByteOrder);
+	BinarySerializer<string>::Write(pStream, pCodec);
+	if (pBase) {
+		BinarySerializer<unsigned char>::Write(pStream, DELTA_BACKUP);
+		BinarySerializer<ullong>::Write(pStream, pBase->GetGeneration());
+	} else
+		BinarySerializer<unsigned char>::Write(pStream, indexed ? INDEXED_BACKUP : FULL_BACKUP);
+	BinarySerializer<map<string, string>>::Write(pStream, pCheckpoint ? *pCheckpoint : map<string, string>());
+
+	if (indexed) {
+		BackupIndex::Write(pStream, pPopulation);
+		return;
+	}
+
+	boost::iostreams::filtering_ostream filter;
+	codec->PushEncoder(filter);
+	bool direct = filter.empty();
+	if (!direct)
+		filter.push(pStream);
+
+	ostream& out = direct ? pStream : filter;
+	{
+		TypeDictionary dict(out);
+		if (pBase)
+			BackupDelta::Write(out, pPopulation, pBase);
+		else
+			BinarySerializer<PopulationPtr>::Write(out, pPopulation);
+	}
+	filter.reset();
+}
+
+/**
+ * Read the header of a back-up file.
+ * If the stream does not start with the magic bytes (legacy back-up), the stream is rewound
+ * and a header with version 0 is returned.
+ * The stream must be seekable so the legacy format can be detected.
+ * @param pStream The input stream, positioned at the beginning of the back-up.
+ * @return The header of the back-up. After the call, the stream is positioned at the data of the back-up.
+ */
+BackupHook::Header BackupHook::ReadHeader(istream& pStream) {
+	Header header { 0, BackupCodec::NONE, FULL_BACKUP, 0, nullptr };
+
+	auto start = pStream.tellg();
+	char magic[sizeof(sMagic)];
+	pStream.read(magic, sizeof(magic));
+
+	if (!pStream || !equal(magic, magic + sizeof(magic), sMagic)) {
+		pStream.clear();
+		pStream.seekg(start);
+		return header;
+	}
+
+	header.version = BinarySerializer<uint>::Read(pStream);
+	if (header.version > sVersion)
+		throw EA_EXCEPTION(EAException, FILE_FEATURE_NOT_SUPPORT,
+				"BackupHook::ReadHeader: Backup format version " + to_string(header.version) + " is not supported.");
+
+	if (header.version >= 2 && BinarySerializer<uint>::Read(pStream) != sByteOrder)
+		throw EA_EXCEPTION(EAException, FILE_FEATURE_NOT_SUPPORT,
+				"BackupHook::ReadHeader: Backup was written on a machine with different byte order.");
+
+	if (header.version >= 3)
+		header.codec = BinarySerializer<string>::Read(pStream);
+
+	if (header.version >= 4) {
+		header.kind = BinarySerializer<unsigned char>::Read(pStream);
+		if (header.kind == DELTA_BACKUP)
+			header.base = BinarySerializer<ullong>::Read(pStream);
+	}
+
+	// An empty record means that no state was captured
+	if (header.version >= 6) {
+		CheckpointPoolPtr checkpoint = make_shared<CheckpointPool>();
+		BinarySerializer<map<string, string>>::Read(pStream, *checkpoint);
+		if (!checkpoint->empty())
+			header.checkpoint = checkpoint;
+	}
+
+	return header;
+}
+
 /**
  * Whether the target directory will be cleared before writing back-up files.
  * @return true if the target directory will be cleared.
@@ -150,4 +414,86 @@ uint BackupHook::GetInterval() const {
 	return mFrequency;
 }
 
+/**
+ * Whether back-up files are written on a background thread.
+ * @return true if back-up files are written asynchronously.
+ */
+bool BackupHook::IsAsync() const {
+	return mAsync;
+}
+
+/**
+ * Set whether back-up files are written on a background thread.
+ * @param pAsync true to write back-up files asynchronously.
+ */
+void BackupHook::SetAsync(bool pAsync) {
+	mAsync = pAsync;
+}
+
+/**
+ * Get the name of the BackupCodec used to compress back-up files.
+ * @return The name of the codec.
+ */
+const string& BackupHook::GetCodec() const {
+	return mCodec;
+}
+
+/**
+ * Set the name of the BackupCodec used to compress back-up files.
+ * @param pCodec The name of the codec (e.g. \tt{"none"} or \tt{"zlib"}).
+ */
+void BackupHook::SetCodec(string pCodec) {
+	mCodec = pCodec;
+}
+
+/**
+ * Get the policy of flushing back-up files to disk.
+ * @return The sync policy.
+ */
+BackupHook::SyncPolicy BackupHook::GetSyncPolicy() const {
+	return mSyncPolicy;
+}
+
+/**
+ * Set the policy of flushing back-up files to disk.
+ * @param pPolicy The sync policy.
+ */
+void BackupHook::SetSyncPolicy(SyncPolicy pPolicy) {
+	mSyncPolicy = pPolicy;
+}
+
+/**
+ * Get the number of back-ups between two full back-ups.
+ * @return The full back-up interval.
+ */
+uint BackupHook::GetFullInterval() const {
+	return mFullInterval;
+}
+
+/**
+ * Set the number of back-ups between two full back-ups.
+ * Back-ups in between are written as deltas of the previous back-up.
+ * @param pInterval The full back-up interval (0 or 1 means all back-ups are full).
+ */
+void BackupHook::SetFullInterval(uint pInterval) {
+	mFullInterval = pInterval;
+}
+
+/**
+ * Whether full back-ups are written with an index.
+ * @return true if full back-ups are indexed.
+ */
+bool BackupHook::IsIndexed() const {
+	return mIndexed;
+}
+
+/**
+ * Set whether full back-ups are written with an index (see BackupIndex).
+ * Indexed back-ups require the codec to be "none".
+ * @param pIndexed true to index full back-ups.
+ */
+void BackupHook::SetIndexed(bool pIndexed) {
+	mIndexed = pIndexed;
+}
+
 }/* namespace ea */
@@ -11,16 +11,38 @@
 #include "../EA/Type/Core.h"
 #include "../core/interface/Hook.h"
 #include "../rtoc/Constructible.h"
+#include <thread>
 
 namespace ea {
 
 class BackupHook: public Hook {
+public:
+	enum SyncPolicy {
+		SYNC_NONE,		///< Leave flushing to the operating system. EAML: \tt{"none"}.
+		SYNC_FILE,		///< Flush the file to disk before renaming it. EAML: \tt{"file"}.
+		SYNC_ALL		///< Flush the file and the directory entry to disk. EAML: \tt{"all"}.
+	};
+
 private:
 	string mDir;
 	uint mFrequency;
 	bool mClear;
+	bool mAsync;
+	string mCodec;
+	SyncPolicy mSyncPolicy;
+	uint mFullInterval;
+	bool mIndexed;
+
+	uint mDeltaCount;
+	PopulationPtr mLastSnapshot;
+
+	thread mWorker;
+	exception_ptr mWorkerError;
 
 	void CreateBackup();
+	void WriteFile(string pFilename, const PopulationPtr& pPopulation, const PopulationPtr& pBase,
+			const CheckpointPoolPtr& pCheckpoint);
+	void WaitForBackup();
 
 protected:
 	virtual void DoInitial() override;
@@ -33,11 +55,41 @@ public:
 	BackupHook(string pDir, uint pFrequency = 0, bool pClear = false);
 	virtual ~BackupHook();
 
+	static const char sMagic[4];
+	static const uint sVersion;
+	static const uint sByteOrder;
+
+	static const unsigned char FULL_BACKUP = 0;
+	static const unsigned char DELTA_BACKUP = 1;
+	static const unsigned char INDEXED_BACKUP = 2;
+
+	struct Header {
+		uint version;		///< The format version (0 for legacy files without header).
+		string codec;		///< The name of the BackupCodec.
+		unsigned char kind;	///< FULL_BACKUP, DELTA_BACKUP or INDEXED_BACKUP.
+		ullong base;		///< The generation of the base back-up (for DELTA_BACKUP only).
+		CheckpointPoolPtr checkpoint;	///< The state captured by Checkpoint (nullptr if none).
+	};
+
 	static long long ExtractGenerationNumber(string pFilename);
+	static void WriteBackup(ostream& pStream, const PopulationPtr& pPopulation, string pCodec = "none",
+			const PopulationPtr& pBase = nullptr, bool pIndexed = false, const CheckpointPoolPtr& pCheckpoint = nullptr);
+	static Header ReadHeader(istream& pStream);
 
 	bool IsClear() const;
 	const string& GetDirectory() const;
 	uint GetInterval() const;
+
+	bool IsAsync() const;
+	void SetAsync(bool pAsync);
+	const string& GetCodec() const;
+	void SetCodec(string pCodec);
+	SyncPolicy GetSyncPolicy() const;
+	void SetSyncPolicy(SyncPolicy pPolicy);
+	uint GetFullInterval() const;
+	void SetFullInterval(uint pInterval);
+	bool IsIndexed() const;
+	void SetIndexed(bool pIndexed);
 };
 
 } /* namespace ea */
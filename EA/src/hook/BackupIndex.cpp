@@ -0,0 +1,111 @@
+/*
+ * BackupIndex.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../pch.h"
+#include "BackupIndex.h"
+#include "../core/Population.h"
+#include "../core/pool/OrganismPool.h"
+#include "../core/pool/GenomePool.h"
+#include "../rtoc/BinarySerializer.h"
+
+namespace ea {
+
+/**
+ * @class BackupIndex
+ * Encoder of indexed back-ups.
+ * An indexed back-up stores the counters, then every Organism and Genome of OrganismPool and GenomePool
+ * one after another (other kinds of Pool are stored as a whole), then an index at the end of the file:
+ * - The class names used in the back-up (the objects only refer to them by ID, see TypeDictionary).
+ * - For each Pool, the offset of every element and, for OrganismPool, the order of the Organism by fitness.
+ * - The offset of the index itself (last 8 bytes).
+ *
+ * All offsets are relative to the beginning of the data (right after the header).
+ * Since every element can be located and decoded independently, BackupReader can load a single Pool,
+ * the top-k Organism, or decode the whole Population in parallel.
+ *
+ * @see BackupHook
+ * @see BackupReader
+ */
+
+#ifndef DOXYGEN_IGNORE
+template<class P>
+static void WriteElements(ostream& pStream, const P& pPool, BackupIndex::PoolEntry& pEntry,
+		function<ullong()> pOffset) {
+	pEntry.offsets.reserve(pPool.size() + 1);
+	for (auto& elem : pPool) {
+		pEntry.offsets.push_back(pOffset());
+		BinarySerializer<typename P::value_type>::Write(pStream, elem);
+	}
+	pEntry.offsets.push_back(pOffset());
+}
+
+static vector<uint> Rank(const OrganismPool& pPool) {
+	for (auto& organism : pPool)
+		if (!organism || !organism->GetFitness())
+			return {};
+
+	vector<uint> ranks(pPool.size());
+	for (uint i = 0; i < ranks.size(); i++)
+		ranks[i] = i;
+	stable_sort(ranks.begin(), ranks.end(), [&pPool](uint a, uint b) {
+		return *pPool[a] > *pPool[b];
+	});
+	return ranks;
+}
+#endif
+
+/**
+ * Write an indexed back-up of the Population (without header) to a stream.
+ * The stream must support tellp().
+ * @param pStream The output stream.
+ * @param pPopulation The Population to be written.
+ */
+void BackupIndex::Write(ostream& pStream, const PopulationPtr& pPopulation) {
+	auto start = pStream.tellp();
+	auto offset = [&pStream, start]() -> ullong {
+		return pStream.tellp() - start;
+	};
+
+	TypeDictionary dict(pStream, false);
+	BinarySerializer<Population::CounterMap>::Write(pStream, pPopulation->GetCounters());
+
+	vector<PoolEntry> entries;
+	for (auto& pool : pPopulation->GetPools()) {
+		PoolEntry entry { pool.first, EMPTY_POOL, { }, { } };
+
+		auto organismPool = dynamic_pointer_cast<OrganismPool>(pool.second);
+		auto genomePool = dynamic_pointer_cast<GenomePool>(pool.second);
+
+		if (organismPool) {
+			entry.mode = ORGANISM_POOL;
+			WriteElements(pStream, *organismPool, entry, offset);
+			entry.ranks = Rank(*organismPool);
+		} else if (genomePool) {
+			entry.mode = GENOME_POOL;
+			WriteElements(pStream, *genomePool, entry, offset);
+		} else if (pool.second) {
+			entry.mode = FULL_POOL;
+			entry.offsets.push_back(offset());
+			BinarySerializer<PoolPtr>::Write(pStream, pool.second);
+			entry.offsets.push_back(offset());
+		}
+		entries.push_back(move(entry));
+	}
+
+	ullong indexOffset = offset();
+	BinarySerializer<vector<string>>::Write(pStream, dict.GetTypeNames());
+	BinarySerializer<uint>::Write(pStream, entries.size());
+	for (auto& entry : entries) {
+		BinarySerializer<uint>::Write(pStream, entry.index);
+		BinarySerializer<unsigned char>::Write(pStream, entry.mode);
+		BinarySerializer<vector<ullong>>::Write(pStream, entry.offsets);
+		BinarySerializer<vector<uint>>::Write(pStream, entry.ranks);
+	}
+	BinarySerializer<ullong>::Write(pStream, indexOffset);
+}
+
+} /* namespace ea */
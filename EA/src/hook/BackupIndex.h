@@ -0,0 +1,35 @@
+/*
+ * BackupIndex.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../EA/Type/Core.h"
+
+namespace ea {
+
+using namespace std;
+
+class BackupIndex {
+public:
+	enum PoolMode : unsigned char {
+		EMPTY_POOL,
+		FULL_POOL,
+		ORGANISM_POOL,
+		GENOME_POOL
+	};
+
+	struct PoolEntry {
+		uint index;				///< The index of the Pool in the Population.
+		PoolMode mode;			///< How the Pool is stored.
+		vector<ullong> offsets;	///< The offsets of all elements (or of the whole Pool), followed by the end offset.
+		vector<uint> ranks;		///< The positions of the Organism from the best to the worst (OrganismPool only).
+	};
+
+	static void Write(ostream& pStream, const PopulationPtr& pPopulation);
+};
+
+} /* namespace ea */
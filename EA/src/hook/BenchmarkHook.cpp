@@ -0,0 +1,139 @@
+/*
+ * BenchmarkHook.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../pch.h"
+#include "BenchmarkHook.h"
+#include "../core/Session.h"
+#include "../core/interface/Strategy.h"
+#include "../misc/Cluster.h"
+#include "../misc/Json.h"
+#include "../misc/MultiThreading.h"
+#include <fstream>
+#include <sys/resource.h>
+
+namespace ea {
+
+/**
+ * @class BenchmarkHook
+ * A Hook which measures the throughput of a run and writes a summary to file when the evolution ends.
+ * The summary is a JSON object which contains:
+ * - the label, the Strategy, the number of threads and the number of cluster ranks,
+ * - the number of generations and evaluations of the run, the wall time and the resulting generations
+ * and evaluations per second,
+ * - the execution time of every phase of the Strategy and of a whole generation (count, total, average,
+ * p50, p90, p99 and max in milliseconds, see Session::GetTimeRecords()),
+ * - the user and system CPU time and the peak resident memory of the process.
+ *
+ * The measurement starts when the evolution starts (after the population is initialized, or when the evolution resumes
+ * from a back-up). In cluster mode, the CPU time and memory are only those of the master process.
+ *
+ * The file is overwritten by every run. The benchmark harness (\tt{openea benchmark}) adds this Hook to every run
+ * and collects the summaries into a scaling report.
+ *
+ * @name{BenchmarkHook}
+ *
+ * @eaml
+ * @attr{file-name, string - Required - The target file to be written to.}
+ * @attr{label, string - Optional - A label copied to the summary (e.g. the name of the configuration).}
+ * @endeaml
+ */
+
+EA_TYPEINFO_CUSTOM_IMPL(BenchmarkHook) {
+	return *ea::TypeInfo("BenchmarkHook")
+		.Add("label", &BenchmarkHook::mLabel)
+		->SetConstructor<BenchmarkHook, string>("file-name");
+}
+
+/**
+ * Create a BenchmarkHook writing the summary to the given file.
+ * @param pFileName The target file to be written to.
+ */
+BenchmarkHook::BenchmarkHook(string pFileName) :
+		mFileName(pFileName), mLabel(), mStartGen(0), mStartEval(0), mStartTime() {
+}
+
+BenchmarkHook::~BenchmarkHook() {
+}
+
+/**
+ * Get the file the summary is written to.
+ * @return The target file name.
+ */
+const string& BenchmarkHook::GetFileName() const {
+	return mFileName;
+}
+
+/**
+ * Get the label copied to the summary.
+ * @return The label.
+ */
+const string& BenchmarkHook::GetLabel() const {
+	return mLabel;
+}
+
+/**
+ * Set the label copied to the summary.
+ * @param pLabel The label (e.g. the name of the configuration).
+ */
+void BenchmarkHook::SetLabel(string pLabel) {
+	mLabel = pLabel;
+}
+
+void BenchmarkHook::DoStart() {
+	mStartGen = GetGeneration();
+	mStartEval = GetEvaluation();
+	mStartTime = chrono::steady_clock::now();
+}
+
+static double ToSeconds(const timeval& pTime) {
+	return pTime.tv_sec + pTime.tv_usec / 1e6;
+}
+
+void BenchmarkHook::DoEnd() {
+	double seconds = chrono::duration<double>(chrono::steady_clock::now() - mStartTime).count();
+	ullong generations = GetGeneration() - mStartGen;
+	ullong evaluations = GetEvaluation() - mStartEval;
+
+	auto& session = GetSession();
+	auto records = session->GetTimeRecords(session->GetStrategy()->GetTimeRecordOrder());
+	records.push_back(session->GetTotalTimeRecord());
+
+	struct rusage usage = { };
+	getrusage(RUSAGE_SELF, &usage);
+
+	ofstream file(mFileName, ios_base::out | ios_base::trunc);
+	if (!file)
+		throw EA_EXCEPTION(EAException, CANNOT_CREATE_FILE,
+				"BenchmarkHook::DoEnd: Cannot create \"" + mFileName + "\".");
+
+	file << setprecision(9) << "{\"label\":";
+	Json::WriteString(file, mLabel);
+	file << ",\"strategy\":";
+	Json::WriteString(file, session->GetStrategy()->GetTypeName());
+	file << ",\"threads\":" << MultiThreading::GetRealNumThreads()
+			<< ",\"ranks\":" << (Cluster::IsEnabled() ? Cluster::GetWorkerStats().size() + 1 : 1)
+			<< ",\"generations\":" << generations << ",\"evaluations\":" << evaluations
+			<< ",\"seconds\":" << seconds
+			<< ",\"gens_per_sec\":" << (seconds > 0 ? generations / seconds : 0)
+			<< ",\"evals_per_sec\":" << (seconds > 0 ? evaluations / seconds : 0)
+			<< ",\"user_seconds\":" << ToSeconds(usage.ru_utime) << ",\"system_seconds\":" << ToSeconds(usage.ru_stime)
+			<< ",\"peak_rss_kb\":" << usage.ru_maxrss << ",\"phases\":[";
+
+	for (uint i = 0; i < records.size(); i++) {
+		auto& record = records[i];
+		file << (i > 0 ? "," : "") << "{\"id\":";
+		Json::WriteString(file, record.id);
+		file << ",\"count\":" << record.count << ",\"total\":" << record.total << ",\"average\":" << record.average
+				<< ",\"p50\":" << record.p50 << ",\"p90\":" << record.p90 << ",\"p99\":" << record.p99
+				<< ",\"max\":" << record.max << "}";
+	}
+	file << "]}" << endl;
+
+	EA_LOG_DEBUG << "BenchmarkHook::DoEnd: Summary written to \"" + mFileName + "\"." << flush;
+}
+
+} /* namespace ea */
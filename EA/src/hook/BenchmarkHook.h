@@ -0,0 +1,43 @@
+/*
+ * BenchmarkHook.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../Common.h"
+#include "../core/interface/Hook.h"
+#include "../rtoc/Constructible.h"
+#include <chrono>
+
+namespace ea {
+
+using namespace std;
+
+class BenchmarkHook : public Hook {
+public:
+	EA_TYPEINFO_CUSTOM_DECL
+
+	BenchmarkHook(string pFileName);
+	virtual ~BenchmarkHook();
+
+	const string& GetFileName() const;
+	const string& GetLabel() const;
+	void SetLabel(string pLabel);
+
+protected:
+	virtual void DoStart() override;
+	virtual void DoEnd() override;
+
+private:
+	string mFileName;
+	string mLabel;
+
+	ullong mStartGen;
+	ullong mStartEval;
+	chrono::steady_clock::time_point mStartTime;
+};
+
+} /* namespace ea */
@@ -7,8 +7,11 @@
 
 #include "../pch.h"
 #include "FitnessReportHook.h"
+#include "BackupCodec.h"
+#include "BackupHook.h"
 #include "../core/Organism.h"
 #include "../core/pool/OrganismPool.h"
+#include "../rtoc/BinarySerializer.h"
 
 namespace ea {
 
@@ -16,9 +19,18 @@ namespace ea {
  * @class FitnessReportHook
  * A Hook which reports the fitness values of the main pool to file.
  * This class is only compatible with Evaluator which outputs ScalarFitness.
- * Using this Hook, a CSV file will be created and stores all the fitness values existed in the main pool (OrganismPool #0).
- * Each row of the CSV file represents a generation and each column represents a fitness value (except for the first column which is
- * the generation number). There is also an option to configure the frequency at which the report will be generated.
+ * Using this Hook, a file will be created and stores all the fitness values existed in the main pool (OrganismPool #0).
+ * Each row of the file represents a generation. There is also an option to configure the frequency at which the report will be generated.
+ *
+ * Two formats are supported:
+ * - CSV (default): each row starts with the generation number, followed by the fitness values.
+ * - Binary: the file starts with the magic "EAFH", the format version, a byte order mark, the name of the BackupCodec
+ * and whether rows are summaries. Each row is then stored (through the codec) as the generation number,
+ * the pool size and the fitness values as raw doubles. The output is block-buffered, so rows do not cause a system call each.
+ * Binary files can be read by FitnessHistoryReader.
+ *
+ * If summary is enabled, a row only contains the pool size, the minimum, the maximum, the mean and the standard deviation
+ * of the fitness values instead of every value.
  *
  * @name{FitnessReportHook}
  *
@@ -27,13 +39,56 @@ namespace ea {
  * @attr{frequency, uint - Optional - The interval of generations between two rows in the file.}
  * @attr{override, bool - Optional - If true\, existed file will be overridden.
  * Otherwise\, an error will be thrown if the file has been existed.}
+ * @attr{format, Format - Optional - The format of the file (default is \tt{"csv"}).}
+ * @attr{summary, bool - Optional - If true\, only summary statistics are written (default is false).}
+ * @attr{codec, string - Optional - Name of the BackupCodec compressing binary files (default is \tt{"none"}).}
  * @endeaml
+ *
+ * @see FitnessHistoryReader
+ */
+
+#ifndef DOXYGEN_IGNORE
+EA_DEFINE_CUSTOM_SERIALIZER(FitnessReportHook::Format, data, ss) {
+	static HashMap<string, FitnessReportHook::Format> strToFormat = {
+		{"csv",    FitnessReportHook::FORMAT_CSV},
+		{"binary", FitnessReportHook::FORMAT_BINARY}
+	};
+
+	string str;
+	if (!bool(ss >> str))
+		return false;
+
+	auto itr = strToFormat.find(str);
+	if (itr == strToFormat.end())
+		return false;
+
+	data = itr->second;
+	return true;
+}
+#endif
+
+/**
+ * The magic bytes at the beginning of every binary fitness report.
+ */
+const char FitnessReportHook::sMagic[4] = { 'E', 'A', 'F', 'H' };
+
+/**
+ * The current version of the binary fitness report format.
+ */
+const uint FitnessReportHook::sVersion = 1;
+
+/**
+ * @var FitnessReportHook::SUMMARY_SIZE
+ * The number of values in a summary row (minimum, maximum, mean and standard deviation).
  */
 
 EA_TYPEINFO_CUSTOM_IMPL(FitnessReportHook) {
 	return *ea::TypeInfo("FitnessReportHook")
 		.Add("override", &FitnessReportHook::mOverride)
 		->Add("frequency", &FitnessReportHook::mFrequency)
+		->Add("format", &FitnessReportHook::mFormat)
+		->Add("summary", &FitnessReportHook::mSummary)
+		->Add("codec", &FitnessReportHook::mCodec)
 		->SetConstructor<FitnessReportHook, string>("file-name");
 }
 
@@ -47,10 +102,18 @@ EA_TYPEINFO_CUSTOM_IMPL(FitnessReportHook) {
  *
  */
 FitnessReportHook::FitnessReportHook(string pFileName, uint pFrequency, bool pOverride)
-		: mFileName(pFileName), mFrequency(pFrequency), mOverride(pOverride), fs() {
+		: mFileName(pFileName), mFrequency(pFrequency), mOverride(pOverride),
+		  mFormat(FORMAT_CSV), mSummary(false), mCodec(BackupCodec::NONE), mFile(), mStream(), mRow() {
 }
 
 FitnessReportHook::~FitnessReportHook() {
+	// If the evolution stopped before DoEnd() (e.g. with an exception), the codec must still write its trailer
+	// (e.g. the end of the zlib stream) before the file is closed, otherwise the rows cannot be read back
+	try {
+		if (!mStream.empty())
+			mStream.reset();
+	} catch (...) {
+	}
 }
 
 void FitnessReportHook::DoInitial() {
@@ -65,7 +128,16 @@ void FitnessReportHook::DoInitial() {
 			EA_LOG_DEBUG << "FitnessReportHook::DoInitial: File \"" + mFileName + "\" overrode." << flush;
 		else
 			EA_LOG_DEBUG << "FitnessReportHook::DoInitial: File \"" + mFileName + "\" created." << flush;
-		fs = std::fstream(mFileName, ios_base::out | ios_base::trunc);
+
+		mFile.open(mFileName, ios_base::out | ios_base::trunc | ios_base::binary);
+		if (!mFile)
+			throw EA_EXCEPTION(EAException, CANNOT_CREATE_FILE,
+					"FitnessReportHook::DoInitial: Cannot create \"" + mFileName + "\".");
+
+		if (mFormat == FORMAT_BINARY)
+			WriteHeader();
+		else
+			mFile << setprecision(17);
 	}
 }
 
@@ -82,18 +154,105 @@ void FitnessReportHook::DoEnd() {
 	if (mFrequency != 0 && generation % mFrequency != 0)
 		CreateEntry();
 
-	if (fs.is_open())
-		fs.close();
+	if (!mStream.empty())
+		mStream.reset();
+	if (mFile.is_open())
+		mFile.close();
+}
+
+void FitnessReportHook::WriteHeader() {
+	mFile.write(sMagic, sizeof(sMagic));
+	BinarySerializer<uint>::Write(mFile, sVersion);
+	BinarySerializer<uint>::Write(mFile, BackupHook::sByteOrder);
+	BinarySerializer<string>::Write(mFile, mCodec);
+	BinarySerializer<bool>::Write(mFile, mSummary);
+
+	BackupCodec::Get(mCodec)->PushEncoder(mStream);
+	mStream.push(mFile, 1 << 16);
 }
 
 void FitnessReportHook::CreateEntry() {
 	OrganismPoolPtr pool = GetMainPool();
-	fs << setprecision(17);
-	fs << GetGeneration() << ",";
+
+	mRow.clear();
 	for (OrganismPtr org : *pool)
-		fs << org->GetFitnessValue() << ",";
-	fs.seekp(-1, ios_base::cur);
-	fs << endl;
+		mRow.push_back(org->GetFitnessValue());
+
+	if (mSummary && !mRow.empty()) {
+		auto range = minmax_element(mRow.begin(), mRow.end());
+		double sum = 0, sumSquare = 0;
+		for (double value : mRow) {
+			sum += value;
+			sumSquare += value * value;
+		}
+		double mean = sum / mRow.size();
+		double stddev = sqrt(max(0.0, sumSquare / mRow.size() - mean * mean));
+		mRow = { *range.first, *range.second, mean, stddev };
+	}
+
+	if (mFormat == FORMAT_BINARY) {
+		BinarySerializer<ullong>::Write(mStream, GetGeneration());
+		BinarySerializer<uint>::Write(mStream, pool->size());
+		BinarySerializer<vector<double>>::Write(mStream, mRow);
+		return;
+	}
+
+	mFile << GetGeneration();
+	if (mSummary)
+		mFile << ',' << pool->size();
+	for (double value : mRow)
+		mFile << ',' << value;
+	mFile << '\n';
+}
+
+/**
+ * Get the format of the report file.
+ * @return The file format.
+ */
+FitnessReportHook::Format FitnessReportHook::GetFormat() const {
+	return mFormat;
+}
+
+/**
+ * Set the format of the report file.
+ * This must be set before the evolution starts.
+ * @param pFormat The file format.
+ */
+void FitnessReportHook::SetFormat(Format pFormat) {
+	mFormat = pFormat;
+}
+
+/**
+ * Whether only summary statistics are written.
+ * @return true if rows contain summary statistics instead of every fitness value.
+ */
+bool FitnessReportHook::IsSummary() const {
+	return mSummary;
+}
+
+/**
+ * Set whether only summary statistics are written.
+ * @param pSummary If true, rows contain the pool size, minimum, maximum, mean and standard deviation only.
+ */
+void FitnessReportHook::SetSummary(bool pSummary) {
+	mSummary = pSummary;
+}
+
+/**
+ * Get the name of the BackupCodec used for binary reports.
+ * @return The codec name.
+ */
+const string& FitnessReportHook::GetCodec() const {
+	return mCodec;
+}
+
+/**
+ * Set the BackupCodec used for binary reports.
+ * @param pCodec The codec name (see BackupCodec::Get()).
+ */
+void FitnessReportHook::SetCodec(string pCodec) {
+	BackupCodec::Get(pCodec);
+	mCodec = pCodec;
 }
 
 } /* namespace ea */
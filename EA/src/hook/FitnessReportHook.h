@@ -11,6 +11,7 @@
 #include "../core/interface/Hook.h"
 #include "../rtoc/Constructible.h"
 #include <fstream>
+#include <boost/iostreams/filtering_stream.hpp>
 
 namespace ea {
 
@@ -20,9 +21,25 @@ class FitnessReportHook : public Hook {
 public:
 	EA_TYPEINFO_CUSTOM_DECL
 
+	enum Format {
+		FORMAT_CSV,		///< One line of text per generation. EAML: \tt{"csv"}.
+		FORMAT_BINARY	///< Fixed-width binary rows (see FitnessHistoryReader). EAML: \tt{"binary"}.
+	};
+
 	FitnessReportHook(string pFileName, uint pFrequency = 0, bool pOverride = false);
 	virtual ~FitnessReportHook();
 
+	static const char sMagic[4];
+	static const uint sVersion;
+	static const uint SUMMARY_SIZE = 4;
+
+	Format GetFormat() const;
+	void SetFormat(Format pFormat);
+	bool IsSummary() const;
+	void SetSummary(bool pSummary);
+	const string& GetCodec() const;
+	void SetCodec(string pCodec);
+
 protected:
 	virtual void DoInitial() override;
 	virtual void DoGenerational() override;
@@ -32,8 +49,15 @@ private:
 	string mFileName;
 	uint mFrequency;
 	bool mOverride;
-	fstream fs;
+	Format mFormat;
+	bool mSummary;
+	string mCodec;
+
+	ofstream mFile;
+	boost::iostreams::filtering_ostream mStream;
+	vector<double> mRow;
 
+	void WriteHeader();
 	void CreateEntry();
 };
 
@@ -0,0 +1,70 @@
+/*
+ * MemoryReportHook.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../pch.h"
+#include "MemoryReportHook.h"
+#include "../core/Population.h"
+#include "../misc/ObjectCounter.h"
+
+namespace ea {
+
+/**
+ * @class MemoryReportHook
+ * A Hook which logs the objects and the memory used by the evolution (see ObjectCounter).
+ * Every few generations, one line is written to the INFO log with:
+ * - the total footprint of everything reachable from the pools of the Population,
+ * - the live Organism, Genome and Fitness instances in the whole process,
+ * - the reachable organisms, Fitness objects and genomes (by type) with their footprint,
+ * - the number of entries and the footprint of every pool.
+ *
+ * Constructing a MemoryReportHook enables ObjectCounter, so the instances created by the run are counted.
+ * The same report is available at \tt{/memory} of RealTimeInfoHook.
+ *
+ * @name{MemoryReportHook}
+ *
+ * @eaml
+ * @attr{frequency, uint - Optional - The interval of generations between two reports (default is 1).}
+ * @endeaml
+ */
+
+EA_TYPEINFO_CUSTOM_IMPL(MemoryReportHook) {
+	return *ea::TypeInfo("MemoryReportHook")
+		.Add("frequency", &MemoryReportHook::mFrequency)
+		->SetConstructor<MemoryReportHook>();
+}
+
+/**
+ * Create a MemoryReportHook and enable ObjectCounter.
+ * @param pFrequency The interval of generations between two reports.
+ */
+MemoryReportHook::MemoryReportHook(uint pFrequency) :
+		mFrequency(pFrequency) {
+	ObjectCounter::SetEnabled(true);
+}
+
+MemoryReportHook::~MemoryReportHook() {
+}
+
+/**
+ * Get the interval of generations between two reports.
+ * @return The interval.
+ */
+uint MemoryReportHook::GetFrequency() const {
+	return mFrequency;
+}
+
+void MemoryReportHook::DoGenerational() {
+	if (!Log::IsEnabled(Log::INFO) || (mFrequency != 0 && GetGeneration() % mFrequency != 0))
+		return;
+
+	auto report = ObjectCounter::Collect(*GetPopulation());
+	LogStream stream(Log::INFO);
+	ObjectCounter::Write(stream, report);
+	stream << flush;
+}
+
+} /* namespace ea */
@@ -0,0 +1,34 @@
+/*
+ * MemoryReportHook.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../Common.h"
+#include "../core/interface/Hook.h"
+#include "../rtoc/Constructible.h"
+
+namespace ea {
+
+using namespace std;
+
+class MemoryReportHook : public Hook {
+public:
+	EA_TYPEINFO_CUSTOM_DECL
+
+	MemoryReportHook(uint pFrequency = 1);
+	virtual ~MemoryReportHook();
+
+	uint GetFrequency() const;
+
+protected:
+	virtual void DoGenerational() override;
+
+private:
+	uint mFrequency;
+};
+
+} /* namespace ea */
@@ -46,6 +46,10 @@ StandardOutputHook::~StandardOutputHook() {
 }
 
 void StandardOutputHook::DoGenerational() {
+	// Do not sort the pool when nothing is displayed
+	if (!Log::IsEnabled(Log::INFO))
+		return;
+
 	auto organism = GetBestOrganism();
 	LogStream info(Log::INFO);
 	info.imbue(std::locale("en_US.UTF-8"));
@@ -0,0 +1,115 @@
+/*
+ * TraceHook.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../pch.h"
+#include "TraceHook.h"
+#include "../misc/Tracer.h"
+#include "../misc/PerfCounters.h"
+
+namespace ea {
+
+/**
+ * @class TraceHook
+ * A Hook which records a timeline of the evolution and writes it as a Chrome trace file.
+ * While the evolution runs, Tracer is enabled and every generation, Strategy phase, Hook call,
+ * fitness evaluation, parallel loop and cluster transfer is recorded as an event on the thread executing it.
+ * When the evolution ends, the events are written to the target file in the Chrome trace event format,
+ * which can be opened with \tt{chrome://tracing} or Perfetto.
+ *
+ * If counters is enabled, PerfCounters is also enabled during the run, so every phase event carries
+ * the hardware counters of the phase.
+ *
+ * If Tracer has already been started elsewhere (e.g. by the program itself), the Hook does not stop it
+ * and only writes the events recorded so far.
+ *
+ * @name{TraceHook}
+ *
+ * @eaml
+ * @attr{file-name, string - Required - The target file to be written to.}
+ * @attr{counters, bool - Optional - If true\, hardware counters are recorded for every phase (default is false).}
+ * @endeaml
+ *
+ * @see Tracer
+ */
+
+EA_TYPEINFO_CUSTOM_IMPL(TraceHook) {
+	return *ea::TypeInfo("TraceHook")
+		.Add("counters", &TraceHook::mCounting)
+		->SetConstructor<TraceHook, string>("file-name");
+}
+
+/**
+ * Create a TraceHook writing the trace to the given file.
+ * @param pFileName The target file to be written to.
+ */
+TraceHook::TraceHook(string pFileName) : mFileName(pFileName), mCounting(false), mOwner(false), mCounterOwner(false) {
+}
+
+TraceHook::~TraceHook() {
+}
+
+/**
+ * Get the file the trace is written to.
+ * @return The target file name.
+ */
+const string& TraceHook::GetFileName() const {
+	return mFileName;
+}
+
+/**
+ * Whether hardware counters are recorded during the run.
+ * @return true if PerfCounters is enabled by this Hook.
+ */
+bool TraceHook::IsCounting() const {
+	return mCounting;
+}
+
+/**
+ * Set whether hardware counters are recorded during the run.
+ * @param pCounting If true, PerfCounters is enabled while the evolution runs.
+ */
+void TraceHook::SetCounting(bool pCounting) {
+	mCounting = pCounting;
+}
+
+void TraceHook::DoInitial() {
+	Begin();
+}
+
+void TraceHook::DoStart() {
+	Begin();
+}
+
+void TraceHook::DoEnd() {
+	if (mOwner) {
+		Tracer::Stop();
+		mOwner = false;
+	}
+	if (mCounterOwner) {
+		PerfCounters::SetEnabled(false);
+		mCounterOwner = false;
+	}
+
+	Tracer::Write(mFileName);
+	EA_LOG_DEBUG << "TraceHook::DoEnd: Trace written to \"" + mFileName + "\"." << flush;
+}
+
+void TraceHook::Begin() {
+	if (mCounting && !PerfCounters::IsEnabled()) {
+		PerfCounters::SetEnabled(true);
+		mCounterOwner = true;
+	}
+
+	if (Tracer::IsEnabled())
+		return;
+
+	Tracer::Clear();
+	Tracer::Start();
+	mOwner = true;
+}
+
+} /* namespace ea */
@@ -0,0 +1,43 @@
+/*
+ * TraceHook.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../Common.h"
+#include "../core/interface/Hook.h"
+#include "../rtoc/Constructible.h"
+
+namespace ea {
+
+using namespace std;
+
+class TraceHook : public Hook {
+public:
+	EA_TYPEINFO_CUSTOM_DECL
+
+	TraceHook(string pFileName);
+	virtual ~TraceHook();
+
+	const string& GetFileName() const;
+	bool IsCounting() const;
+	void SetCounting(bool pCounting);
+
+protected:
+	virtual void DoInitial() override;
+	virtual void DoStart() override;
+	virtual void DoEnd() override;
+
+private:
+	string mFileName;
+	bool mCounting;
+	bool mOwner;
+	bool mCounterOwner;
+
+	void Begin();
+};
+
+} /* namespace ea */
@@ -0,0 +1,322 @@
+/*
+ * FitnessHistory.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../../pch.h"
+#include "FitnessHistory.h"
+
+namespace ea {
+
+/**
+ * @class FitnessHistory
+ * Bounded-memory history of fitness summaries at multiple resolutions (similar to a round-robin database).
+ * The history consists of LEVELS levels of the same capacity. Level 0 keeps one Bucket per generation,
+ * and every @tt{factor} consecutive buckets of a level are merged into one bucket of the next level.
+ * Each level only keeps its latest buckets, so recent generations are kept at full resolution while older generations
+ * are progressively aggregated (minimum, maximum, mean and standard deviation are merged exactly).
+ * The memory usage is fixed by the total size, regardless of the number of generations.
+ *
+ * Query() answers a range query from the level whose bucket width matches the requested resolution,
+ * so its cost depends on the resolution and not on the length of the range.
+ *
+ * Add() and Clear() must be called by a single thread, while the queries can be run concurrently by any number of threads
+ * without locking. Each level is a RingStore, and a query only reads the buckets published when it started,
+ * taking the coarser levels first so that a finer level is never older than a coarser one.
+ * If some of the buckets it needs are removed by the writer meanwhile, Query() starts again.
+ *
+ * @see RealTimeInfoHook
+ */
+
+/**
+ * @struct FitnessHistory::Bucket
+ * Fitness summary of one or more consecutive generations.
+ */
+
+/**
+ * Create an empty history.
+ * @param pSize The total number of buckets kept over all levels (determines the memory usage).
+ * @param pFactor The number of buckets merged into a bucket of the next level (at least 2).
+ */
+FitnessHistory::FitnessHistory(uint pSize, uint pFactor) :
+		mCapacity(max(pSize / LEVELS, 1u)), mFactor(max(pFactor, 2u)), mLevels(LEVELS) {
+	Clear();
+}
+
+/**
+ * Add the fitness summary of a generation.
+ * Generations must be added in increasing order.
+ * @param pGeneration The generation number.
+ * @param pMin The minimum fitness value.
+ * @param pMax The maximum fitness value.
+ * @param pMean The mean fitness value.
+ * @param pSd The standard deviation of fitness values.
+ */
+void FitnessHistory::Add(ullong pGeneration, double pMin, double pMax, double pMean, double pSd) {
+	Push(0, { pGeneration, 1, pMin, pMax, pMean, pSd });
+}
+
+/**
+ * Get the fitness summaries over a range of generations.
+ * The range is divided into at most @p pResolution consecutive groups of generations, and one Bucket is returned per group.
+ * Generations which have been aggregated further than the requested resolution are returned in their stored buckets.
+ * @param pFrom The first generation of the range.
+ * @param pTo The last generation of the range (inclusive).
+ * @param pResolution The maximum number of returned buckets.
+ * @return The buckets ordered by generation (empty if no stored generation is in the range).
+ */
+vector<FitnessHistory::Bucket> FitnessHistory::Query(ullong pFrom, ullong pTo, uint pResolution) const {
+	if (pFrom > pTo || pResolution == 0)
+		return { };
+
+	// The level whose buckets are not wider than a requested group
+	ullong width = (pTo - pFrom) / pResolution + 1;
+	uint ideal = 0;
+	for (ullong span = mFactor; ideal + 1 < LEVELS && span <= width; span *= mFactor)
+		ideal++;
+
+	// Start again if the writer removed some of the buckets while they were collected
+	vector<Bucket> buckets;
+	while (!Collect(pFrom, pTo, ideal, buckets))
+		buckets.clear();
+
+	sort(buckets.begin(), buckets.end(), [] (const Bucket& pLeft, const Bucket& pRight) {
+		return pLeft.from < pRight.from;
+	});
+
+	// Group the buckets into the requested resolution
+	vector<Bucket> result;
+	ullong span = pTo - pFrom + 1;
+	ullong lastGroup = 0;
+	for (auto& bucket : buckets) {
+		ullong group = ullong(double(max(bucket.from, pFrom) - pFrom) * pResolution / span);
+		if (!result.empty() && group == lastGroup)
+			Merge(result.back(), bucket);
+		else
+			result.push_back(bucket);
+		lastGroup = group;
+	}
+	return result;
+}
+
+/**
+ * Collect the stored buckets over a range of generations, using the coarser levels only for the generations
+ * which are no longer kept in the given level.
+ * @param pFrom The first generation of the range.
+ * @param pTo The last generation of the range (inclusive).
+ * @param pLevel The finest level used for the older generations.
+ * @param pBuckets Receives the buckets.
+ * @return false if a bucket was removed during the collection (the buckets are then incomplete).
+ */
+bool FitnessHistory::Collect(ullong pFrom, ullong pTo, uint pLevel, vector<Bucket>& pBuckets) const {
+	// The buckets published so far, from the coarsest level (a bucket is published in a finer level first).
+	// The begins are read first, so a bucket removed from a finer level is always found in the coarser one.
+	// Only these buckets are read, the collection is incomplete if one of them is removed meanwhile.
+	ullong begins[LEVELS], sizes[LEVELS];
+	for (uint i = 0; i < LEVELS; i++)
+		begins[i] = mLevels[i].buckets->GetBegin();
+	for (uint i = LEVELS; i-- > 0; ) {
+		sizes[i] = mLevels[i].buckets->GetSize();
+		begins[i] = min(begins[i], sizes[i]);
+	}
+
+	bool complete = true;
+
+	// The generations after the last bucket of each level (not merged yet)
+	ullong ends[LEVELS + 1];
+	for (uint i = 0; i < LEVELS; i++) {
+		Bucket last;
+		ends[i] = 0;
+		if (sizes[i] > begins[i]) {
+			if (mLevels[i].buckets->Get(sizes[i] - 1, last))
+				ends[i] = last.from + last.count;
+			else
+				complete = false;
+		}
+	}
+	ends[LEVELS] = 0;
+
+	// Each level starts after the generations already collected from the coarser levels
+	auto collect = [&] (uint pLevel, ullong pStart, ullong pEnd) {
+		const Level& level = mLevels[pLevel];
+		if (!pBuckets.empty())
+			pStart = max(pStart, pBuckets.back().from + pBuckets.back().count);
+		Bucket bucket;
+		for (ullong i = LowerBound(level, begins[pLevel], pEnd, max(pStart, pFrom), complete); i < pEnd; i++) {
+			if (!level.buckets->Get(i, bucket)) {
+				complete = false;
+				continue;
+			}
+			if (bucket.from > pTo)
+				break;
+			pBuckets.push_back(bucket);
+		}
+	};
+
+	// Older generations which are only kept in coarser levels
+	for (uint i = LEVELS - 1; i > pLevel; i--) {
+		const Level& level = mLevels[i];
+		Bucket finerFirst, bucket;
+		if (sizes[i] == begins[i] || sizes[i - 1] == begins[i - 1])
+			continue;
+		if (!mLevels[i - 1].buckets->Get(begins[i - 1], finerFirst))
+			return false;
+		ullong end = LowerBound(level, begins[i], sizes[i], finerFirst.from, complete);
+		if (end < sizes[i] && level.buckets->Get(end, bucket) && bucket.from < finerFirst.from)
+			end++;
+		collect(i, 0, end);
+	}
+
+	// The given level, then the recent generations which are not merged into it yet
+	collect(pLevel, 0, sizes[pLevel]);
+	for (int i = int(pLevel) - 1; i >= 0; i--)
+		collect(i, ends[i + 1], sizes[i]);
+	return complete;
+}
+
+/**
+ * Get the full-resolution summaries of the latest generations.
+ * @param pFrom The first wanted generation.
+ * @return The single-generation buckets from @p pFrom (or the oldest one still kept at full resolution).
+ */
+vector<FitnessHistory::Bucket> FitnessHistory::GetRecent(ullong pFrom) const {
+	const Level& level = mLevels[0];
+	ullong size = level.buckets->GetSize();
+	bool complete;
+
+	vector<Bucket> result;
+	Bucket bucket;
+	for (ullong i = LowerBound(level, level.buckets->GetBegin(), size, pFrom, complete); i < size; i++)
+		if (level.buckets->Get(i, bucket))
+			result.push_back(bucket);
+	return result;
+}
+
+/**
+ * Get the finest stored bucket containing a generation.
+ * @param pGeneration The generation number.
+ * @param pBucket Receives the bucket (a single generation if it is still kept at full resolution).
+ * @return false if the generation is not stored.
+ */
+bool FitnessHistory::Get(ullong pGeneration, Bucket& pBucket) const {
+	bool complete;
+	for (auto& level : mLevels) {
+		ullong size = level.buckets->GetSize();
+		ullong index = LowerBound(level, level.buckets->GetBegin(), size, pGeneration, complete);
+		if (index < size && level.buckets->Get(index, pBucket) && pBucket.from <= pGeneration)
+			return true;
+	}
+	return false;
+}
+
+/**
+ * Get the oldest stored bucket.
+ * @param pBucket Receives the bucket (from the coarsest level which is not empty).
+ * @return false if the history is empty.
+ */
+bool FitnessHistory::GetFirst(Bucket& pBucket) const {
+	for (uint i = LEVELS; i-- > 0; )
+		if (GetOldest(mLevels[i], mLevels[i].buckets->GetSize(), pBucket))
+			return true;
+	return false;
+}
+
+/**
+ * Get the summary of the last added generation.
+ * @param pBucket Receives the bucket.
+ * @return false if the history is empty.
+ */
+bool FitnessHistory::GetLast(Bucket& pBucket) const {
+	ullong size = mLevels[0].buckets->GetSize();
+	return size > 0 && mLevels[0].buckets->Get(size - 1, pBucket);
+}
+
+/**
+ * Remove all generations.
+ * Must not be called while other threads are querying the history.
+ */
+void FitnessHistory::Clear() {
+	for (auto& level : mLevels) {
+		level.buckets = make_shared<RingStore<Bucket>>(mCapacity);
+		level.merged = 0;
+	}
+}
+
+/**
+ * Get the total number of buckets kept over all levels.
+ * @return The maximum number of buckets.
+ */
+uint FitnessHistory::GetSize() const {
+	return mCapacity * LEVELS;
+}
+
+/**
+ * Get the number of buckets merged into a bucket of the next level.
+ * @return The aggregation factor.
+ */
+uint FitnessHistory::GetFactor() const {
+	return mFactor;
+}
+
+void FitnessHistory::Push(uint pLevel, const Bucket& pBucket) {
+	mLevels[pLevel].buckets->Append(pBucket);
+
+	if (pLevel + 1 == LEVELS)
+		return;
+
+	Level& next = mLevels[pLevel + 1];
+	if (next.merged == 0)
+		next.pending = pBucket;
+	else
+		Merge(next.pending, pBucket);
+
+	if (++next.merged == mFactor) {
+		next.merged = 0;
+		Push(pLevel + 1, next.pending);
+	}
+}
+
+bool FitnessHistory::GetOldest(const Level& pLevel, ullong pSize, Bucket& pBucket) const {
+	// Skip the buckets removed while reading
+	for (ullong i = pLevel.buckets->GetBegin(); i < pSize; i = max(i + 1, pLevel.buckets->GetBegin()))
+		if (pLevel.buckets->Get(i, pBucket))
+			return true;
+	return false;
+}
+
+ullong FitnessHistory::LowerBound(const Level& pLevel, ullong pBegin, ullong pEnd, ullong pGeneration,
+		bool& pComplete) const {
+	// The first bucket which ends after the generation (the removed buckets are the oldest ones)
+	ullong low = min(pBegin, pEnd), high = pEnd;
+	Bucket bucket;
+	while (low < high) {
+		ullong middle = (low + high) / 2;
+		if (!pLevel.buckets->Get(middle, bucket)) {
+			pComplete = false;
+			low = middle + 1;
+		}
+		else if (bucket.from + bucket.count <= pGeneration)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+	return low;
+}
+
+void FitnessHistory::Merge(Bucket& pTarget, const Bucket& pSource) {
+	double count = pTarget.count + pSource.count;
+	double mean = (pTarget.mean * pTarget.count + pSource.mean * pSource.count) / count;
+	double square = ((pTarget.sd * pTarget.sd + pTarget.mean * pTarget.mean) * pTarget.count
+			+ (pSource.sd * pSource.sd + pSource.mean * pSource.mean) * pSource.count) / count;
+
+	pTarget.from = min(pTarget.from, pSource.from);
+	pTarget.count += pSource.count;
+	pTarget.min = min(pTarget.min, pSource.min);
+	pTarget.max = max(pTarget.max, pSource.max);
+	pTarget.mean = mean;
+	pTarget.sd = sqrt(max(0.0, square - mean * mean));
+}
+
+} /* namespace ea */
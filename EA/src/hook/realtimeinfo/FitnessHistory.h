@@ -0,0 +1,63 @@
+/*
+ * FitnessHistory.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../../Common.h"
+#include "../../misc/RingStore.h"
+
+namespace ea {
+
+using namespace std;
+
+class FitnessHistory {
+public:
+	struct Bucket {
+		ullong from;	///< The first generation in the bucket.
+		ullong count;	///< The number of generations in the bucket.
+		double min;		///< The minimum fitness value.
+		double max;		///< The maximum fitness value.
+		double mean;	///< The mean fitness value.
+		double sd;		///< The standard deviation of fitness values.
+	};
+
+	FitnessHistory(uint pSize = DEFAULT_SIZE, uint pFactor = DEFAULT_FACTOR);
+
+	void Add(ullong pGeneration, double pMin, double pMax, double pMean, double pSd);
+	vector<Bucket> Query(ullong pFrom, ullong pTo, uint pResolution) const;
+	vector<Bucket> GetRecent(ullong pFrom) const;
+	bool Get(ullong pGeneration, Bucket& pBucket) const;
+	bool GetFirst(Bucket& pBucket) const;
+	bool GetLast(Bucket& pBucket) const;
+	void Clear();
+
+	uint GetSize() const;
+	uint GetFactor() const;
+
+	static const uint LEVELS = 10;
+	static const uint DEFAULT_SIZE = 16384;
+	static const uint DEFAULT_FACTOR = 4;
+
+private:
+	struct Level {
+		Ptr<RingStore<Bucket>> buckets;
+		Bucket pending;
+		uint merged;
+	};
+
+	uint mCapacity;
+	uint mFactor;
+	vector<Level> mLevels;
+
+	void Push(uint pLevel, const Bucket& pBucket);
+	bool Collect(ullong pFrom, ullong pTo, uint pLevel, vector<Bucket>& pBuckets) const;
+	bool GetOldest(const Level& pLevel, ullong pSize, Bucket& pBucket) const;
+	ullong LowerBound(const Level& pLevel, ullong pBegin, ullong pEnd, ullong pGeneration, bool& pComplete) const;
+	static void Merge(Bucket& pTarget, const Bucket& pSource);
+};
+
+} /* namespace ea */
@@ -20,6 +20,8 @@ using namespace boost::property_tree;
 EA_TYPEINFO_CUSTOM_IMPL(RealTimeInfoHook) {
 	return *ea::TypeInfo("RealTimeInfoHook").
 			Add("port", &RealTimeInfoHook::mPort)
+			->Add("history-size", &RealTimeInfoHook::mHistorySize)
+			->Add("history-factor", &RealTimeInfoHook::mHistoryFactor)
 			->SetConstructor<RealTimeInfoHook>();
 }
 
@@ -34,6 +36,8 @@ EA_TYPEINFO_CUSTOM_IMPL(RealTimeInfoHook) {
  *
  * @eaml
  * @attr{port, uint - Optional - The port of the server (default in random).}
+ * @attr{history-size, uint - Optional - The maximum number of fitness summaries kept in memory (default is 16384).}
+ * @attr{history-factor, uint - Optional - The number of summaries merged when older generations are aggregated (default is 4).}
  * @endeaml
  *
  * @par Web API
@@ -42,7 +46,24 @@ EA_TYPEINFO_CUSTOM_IMPL(RealTimeInfoHook) {
  * @attr{/fitness, Get fitness summary over a range of generations. (**query**: \tt{"from"}\, \tt{"to"}\, \tt{"res"} (resolution))}
  * @attr{/fitness/\<gen\>, Get fitness summary at a specific generation number.}
  * @attr{/fitness/last, Get fitness summary of the last generation.}
+ * @attr{/fitness/stream, Server-sent events stream pushing the fitness summary of every new generation.
+ * (**query**: \tt{"from"} (first generation to replay\, default is the next one)\, the \tt{"Last-Event-ID"} header resumes a stream)}
+ * @attr{/timings, Get the execution time statistics of every phase so far (see Session::GetTimeRecords()).}
+ * @attr{/throughput, Get the number of evaluations and generations per second\, overall and over the last generations.}
+ * @attr{/threads, Get the busy time and utilisation of every thread in parallel loops (see MultiThreading::GetThreadStats()).}
+ * @attr{/cluster, Get the tasks\, transferred bytes and utilisation of every cluster slave node (see Cluster::GetWorkerStats()).}
+ * @attr{/memory, Get the live objects and the memory used by the pools (see ObjectCounter).
+ * The report is collected at the end of the current generation\, so the response waits until then.
+ * Only available when ObjectCounter is enabled (e.g. by a MemoryReportHook).}
  * @enddl
+ *
+ * The fitness summaries are computed by a separate thread, so the evolution thread only copies the fitness values.
+ * They are stored in a FitnessHistory: recent generations are kept individually while older ones are merged into
+ * summaries of consecutive generations, so the memory usage is bounded by \tt{history-size} however long the run is.
+ * The summaries returned by \tt{/fitness} and \tt{/fitness/\<gen\>} therefore may cover several generations
+ * (given by the \tt{"generations"} field). The fitness requests are answered with status 503 when the evolution is not running.
+ * The other statistics are read from counters maintained by the evolution, so a request never blocks the evolution thread.
+ * Times are in milliseconds, utilisations are fractions of the time elapsed since the evolution started.
  */
 
 /**
@@ -51,7 +72,11 @@ EA_TYPEINFO_CUSTOM_IMPL(RealTimeInfoHook) {
  * @param pPort The port number of the server (default is random).
  */
 RealTimeInfoHook::RealTimeInfoHook(uint pPort) :
-	mPort(pPort), mService(), mThread(), mStartGen(0), mFitnessRecords() {
+	mPort(pPort), mService(), mThread(), mStartGen(0), mStartEval(0), mSession(), mStartTime(),
+	mStartThreadStats(), mStartWorkerStats(), mProgress(), mProgressCount(0),
+	mHistorySize(FitnessHistory::DEFAULT_SIZE), mHistoryFactor(FitnessHistory::DEFAULT_FACTOR), mHistory(),
+	mStatsThread(), mQueueMutex(), mQueueCondition(), mQueue(), mStopping(false), mStreamMutex(), mStreams(),
+	mMemoryMutex(), mMemoryRequests(), mMemoryRequested(false) {
 
 	if (mPort == 0)
 		mPort = uniform_int_distribution<uint>(1024, 65535)(Random::generator);
@@ -77,44 +102,217 @@ uint RealTimeInfoHook::GetPort() {
 	return mPort;
 }
 
+/**
+ * Set the memory limit of the fitness history.
+ * This must be set before the evolution starts.
+ * @param pSize The maximum number of fitness summaries kept in memory.
+ * @param pFactor The number of summaries merged when older generations are aggregated.
+ */
+void RealTimeInfoHook::SetHistory(uint pSize, uint pFactor) {
+	mHistorySize = pSize;
+	mHistoryFactor = pFactor;
+}
+
 void RealTimeInfoHook::DoStart() {
 	mStartGen = GetGeneration();
+	mStartEval = GetEvaluation();
+	mSession = GetSession();
+	mStartTime = chrono::steady_clock::now();
+	mStartThreadStats = MultiThreading::GetThreadStats();
+	mStartWorkerStats = Cluster::GetWorkerStats();
+	mProgressCount = 0;
+	atomic_store(&mHistory, make_shared<FitnessHistory>(mHistorySize, mHistoryFactor));
+
+	mStopping = false;
+	mStatsThread = thread(&RealTimeInfoHook::StatsRoutine, this);
 
     mSettings->set_port(mPort);
     mThread = thread(bind(&Service::start, ref(mService), mSettings));
 }
 
 void RealTimeInfoHook::DoEnd() {
+	// Let the statistics thread finish the remaining generations
+	{
+		lock_guard<mutex> lock(mQueueMutex);
+		mStopping = true;
+	}
+	mQueueCondition.notify_one();
+	mStatsThread.join();
+
+	{
+		lock_guard<mutex> lock(mStreamMutex);
+		for (auto& stream : mStreams)
+			if (stream.session->is_open())
+				stream.session->close("event: end\ndata: {}\n\n");
+		mStreams.clear();
+	}
+	{
+		lock_guard<mutex> lock(mMemoryMutex);
+		for (auto& request : mMemoryRequests)
+			request->close(503, "");
+		mMemoryRequests.clear();
+	}
+
 	mService.stop();
 	mThread.join();
 
 	EA_LOG_DEBUG<< "RealTimeInfoHook: Server closed." << flush;
-	mFitnessRecords.clear();
+	atomic_store(&mHistory, Ptr<FitnessHistory>());
+	mSession = nullptr;
 }
 
 void RealTimeInfoHook::DoGenerational() {
 	OrganismPoolPtr pool = GetMainPool();
 
-	FitnessRecord record;
-	record.max = -INFINITY;
-	record.min = INFINITY;
-	record.mean = 0;
-	record.sd = 0;
-
-	for (OrganismPtr org : *pool) {
-		double fitness = org->GetFitnessValue();
-		if (fitness > record.max)
-			record.max = fitness;
-		if (fitness < record.min)
-			record.min = fitness;
-		record.mean += fitness;
-		record.sd += fitness * fitness;
+	// Only copy the values here, the statistics are computed by the statistics thread
+	vector<double> values;
+	values.reserve(pool->size());
+	for (OrganismPtr org : *pool)
+		values.push_back(org->GetFitnessValue());
+
+	{
+		lock_guard<mutex> lock(mQueueMutex);
+		mQueue.emplace_back(GetGeneration(), move(values));
+	}
+	mQueueCondition.notify_one();
+
+	// Progress sample (single writer, the count is published last)
+	ullong count = mProgressCount.load(memory_order_relaxed);
+	ProgressSample& sample = mProgress[count % PROGRESS_SAMPLES];
+	sample.time.store(chrono::duration_cast<chrono::nanoseconds>(
+			chrono::steady_clock::now() - mStartTime).count(), memory_order_relaxed);
+	sample.generation.store(GetGeneration(), memory_order_relaxed);
+	sample.evaluation.store(GetEvaluation(), memory_order_relaxed);
+	mProgressCount.store(count + 1, memory_order_release);
+
+	// The pools can only be walked by the evolution thread, so the memory report is only collected when requested
+	if (mMemoryRequested.exchange(false, memory_order_acquire)) {
+		vector<Ptr<restbed::Session>> requests;
+		{
+			lock_guard<mutex> lock(mMemoryMutex);
+			requests.swap(mMemoryRequests);
+		}
+		if (!requests.empty()) {
+			auto data = make_shared<ptree>(ToTree(ObjectCounter::Collect(*GetPopulation())));
+			mService.schedule([this, requests, data] {
+				for (auto& request : requests)
+					Response(request, *data);
+			});
+		}
+	}
+}
+
+void RealTimeInfoHook::StatsRoutine() {
+	while (true) {
+		pair<ullong, vector<double>> entry;
+		{
+			unique_lock<mutex> lock(mQueueMutex);
+			mQueueCondition.wait(lock, [this] { return mStopping || !mQueue.empty(); });
+			if (mQueue.empty())
+				return;
+			entry = move(mQueue.front());
+			mQueue.pop_front();
+		}
+
+		AddRecord(entry.first, entry.second);
+		if (mService.is_up())
+			mService.schedule(bind(&RealTimeInfoHook::PushStreams, this));
 	}
+}
+
+void RealTimeInfoHook::AddRecord(ullong pGeneration, const vector<double>& pValues) {
+	double max = -INFINITY, min = INFINITY, mean = 0, sd = 0;
+
+	for (double fitness : pValues) {
+		if (fitness > max)
+			max = fitness;
+		if (fitness < min)
+			min = fitness;
+		mean += fitness;
+		sd += fitness * fitness;
+	}
+
+	mean /= pValues.size();
+	sd = sqrt(sd / pValues.size() - mean * mean);
+	mHistory->Add(pGeneration, min, max, mean, sd);
+}
+
+ptree RealTimeInfoHook::ToTree(const FitnessHistory::Bucket& pBucket) {
+	ptree data;
+	data.put("max", pBucket.max);
+	data.put("min", pBucket.min);
+	data.put("mean", pBucket.mean);
+	data.put("sd", pBucket.sd);
+	if (pBucket.count > 1)
+		data.put("generations", pBucket.count);
+	return data;
+}
+
+ptree RealTimeInfoHook::ToTree(const ObjectCounter::Report& pReport) {
+	auto putUsage = [] (const ObjectCounter::Usage& pUsage) {
+		ptree data;
+		data.put("count", pUsage.count);
+		data.put("bytes", pUsage.bytes);
+		return data;
+	};
+
+	ptree live;
+	for (uint i = 0; i < ObjectCounter::NUM_KINDS; i++)
+		live.put(ObjectCounter::GetName(i), pReport.live[i]);
+
+	ptree genomes;
+	for (auto& usage : pReport.genomes)
+		genomes.push_back(make_pair(usage.type, putUsage(usage)));
+
+	ptree pools;
+	for (auto& usage : pReport.pools) {
+		ptree pool = putUsage(usage);
+		pool.put("pool", usage.type);
+		pools.push_back(make_pair("", pool));
+	}
+
+	ptree data;
+	data.put("generation", pReport.generation);
+	data.put("bytes", pReport.totalBytes);
+	data.put_child("live", live);
+	data.put_child("organisms", putUsage(pReport.organisms));
+	data.put_child("fitness", putUsage(pReport.fitness));
+	data.put_child("genomes", genomes);
+	data.put_child("pools", pools);
+	return data;
+}
+
+void RealTimeInfoHook::PushStreams() {
+	auto history = atomic_load(&mHistory);
+	if (!history)
+		return;
+
+	lock_guard<mutex> lock(mStreamMutex);
+
+	for (auto stream = mStreams.begin(); stream != mStreams.end(); ) {
+		if (stream->session->is_closed()) {
+			stream = mStreams.erase(stream);
+			continue;
+		}
 
-	record.mean /= pool->size();
-	record.sd = sqrt(record.sd / pool->size() - record.mean * record.mean);
+		string events;
+		for (auto& bucket : history->GetRecent(stream->next)) {
+			ptree data = ToTree(bucket);
+			data.put("generation", bucket.from);
+			events += "id: " + to_string(bucket.from) + "\ndata: " + ToJSON(data) + "\n";
+			stream->next = bucket.from + 1;
+		}
 
-	mFitnessRecords.push_back(record);
+		if (!events.empty())
+			stream->session->yield(events);
+		stream++;
+	}
+}
+
+string RealTimeInfoHook::ToJSON(const ptree& pData) {
+	ostringstream oss;
+	json_parser::write_json(oss, pData, false);
+	return oss.str();
 }
 
 void RealTimeInfoHook::ConfigurateResources() {
@@ -134,6 +332,36 @@ void RealTimeInfoHook::ConfigurateResources() {
 	resource->set_paths({"/fitness/{at: [0-9]*}", "/fitness/{cmd: last}"});
 	resource->set_method_handler("GET", bind(&RealTimeInfoHook::FitnessAtHandler, this, _1));
 	mService.publish(resource);
+
+	resource = make_shared<Resource>();
+	resource->set_path("/fitness/stream");
+	resource->set_method_handler("GET", bind(&RealTimeInfoHook::FitnessStreamHandler, this, _1));
+	mService.publish(resource);
+
+	resource = make_shared<Resource>();
+	resource->set_path("/timings");
+	resource->set_method_handler("GET", bind(&RealTimeInfoHook::TimingsHandler, this, _1));
+	mService.publish(resource);
+
+	resource = make_shared<Resource>();
+	resource->set_path("/throughput");
+	resource->set_method_handler("GET", bind(&RealTimeInfoHook::ThroughputHandler, this, _1));
+	mService.publish(resource);
+
+	resource = make_shared<Resource>();
+	resource->set_path("/threads");
+	resource->set_method_handler("GET", bind(&RealTimeInfoHook::ThreadsHandler, this, _1));
+	mService.publish(resource);
+
+	resource = make_shared<Resource>();
+	resource->set_path("/cluster");
+	resource->set_method_handler("GET", bind(&RealTimeInfoHook::ClusterHandler, this, _1));
+	mService.publish(resource);
+
+	resource = make_shared<Resource>();
+	resource->set_path("/memory");
+	resource->set_method_handler("GET", bind(&RealTimeInfoHook::MemoryHandler, this, _1));
+	mService.publish(resource);
 }
 
 void RealTimeInfoHook::Response(const Ptr<restbed::Session>& session, ptree &data) {
@@ -145,6 +373,10 @@ void RealTimeInfoHook::Response(const Ptr<restbed::Session>& session, ptree &dat
 				{"Content-Type", "application/json"}});
 }
 
+float RealTimeInfoHook::GetElapsedTime() const {
+	return chrono::duration_cast<chrono::duration<float, milli>>(chrono::steady_clock::now() - mStartTime).count();
+}
+
 void RealTimeInfoHook::StatusHandler(const Ptr<restbed::Session> session) {
 	ptree data;
 	data.put("generation", GetGeneration());
@@ -178,44 +410,28 @@ void RealTimeInfoHook::FitnessHandler(const Ptr<restbed::Session> session) {
 		return;
 	}
 
-	if (from < (llong)mStartGen) {
-		from = mStartGen;
-		if (to < from) to = from;
+	// Only query the stored generations
+	auto history = atomic_load(&mHistory);
+	if (!history) {
+		session->close(503, "");
+		return;
 	}
-	if (to >= (llong)(mStartGen + mFitnessRecords.size())) {
-		to = mStartGen + mFitnessRecords.size() - 1;
-		if (from > to) from = to;
+	FitnessHistory::Bucket first, last;
+	if (!history->GetFirst(first) || !history->GetLast(last)) {
+		session->close(404, "");
+		return;
 	}
-
-	// Resolution calculation
-	llong delta = to - from;
-	if (delta + 1 < res)
-		res = delta + 1;
-
-	int realRes = (res == 1 ? 1 : res - 1);
-	int step = delta / realRes;
-	double remain = (delta - (llong)step * realRes) / (double)realRes;
+	from = max<llong>(from, first.from);
+	to = min<llong>(to, last.from);
 
 	// Put data in
 	ptree tree;
+	for (auto& bucket : history->Query(from, to, res))
+		tree.put_child(to_string(bucket.from), ToTree(bucket));
 
-	double excess = 0;
-	llong gen = (res == 1 ? to : from);
-	for (int i = 0; i < res; i++, gen += step) {
-		ptree data;
-		llong realGen = gen + (excess >= 0.5 ? 1 : 0);
-		FitnessRecord record = mFitnessRecords[realGen - mStartGen];
-		data.put("max", record.max);
-		data.put("min", record.min);
-		data.put("mean", record.mean);
-		data.put("sd", record.sd);
-		tree.put_child(to_string(realGen), data);
-
-		excess += remain;
-		if (excess >= 1) {
-			excess--;
-			gen++;
-		}
+	if (tree.empty()) {
+		session->close(404, "");
+		return;
 	}
 
 	// Response
@@ -224,15 +440,25 @@ void RealTimeInfoHook::FitnessHandler(const Ptr<restbed::Session> session) {
 
 void RealTimeInfoHook::FitnessAtHandler(const Ptr<restbed::Session> session) {
 	const auto request = session->get_request();
-	llong at = 0;
+	auto history = atomic_load(&mHistory);
+	if (!history) {
+		session->close(503, "");
+		return;
+	}
+	FitnessHistory::Bucket bucket;
+	bool found = false;
 
 	// Parsing
 	try {
-		if (request->has_path_parameter("at"))
-			at = stoll(request->get_path_parameter("at"));
+		if (request->has_path_parameter("at")) {
+			llong at = stoll(request->get_path_parameter("at"));
+			if (at < 0)
+				throw exception();
+			found = history->Get(at, bucket);
+		}
 		else if (request->has_path_parameter("cmd")) {
 			if (request->get_path_parameter("cmd") == "last")
-				at = mStartGen + mFitnessRecords.size() - 1;
+				found = history->GetLast(bucket);
 			else throw exception();
 		}
 		else throw exception();
@@ -241,26 +467,247 @@ void RealTimeInfoHook::FitnessAtHandler(const Ptr<restbed::Session> session) {
 		return;
 	}
 
-	if (at < 0) {
-		session->close(400, "");
+	if (!found) {
+		session->close(404, "");
 		return;
 	}
 
-	if (at < (llong)mStartGen || at >= (llong)(mStartGen + mFitnessRecords.size())) {
-		session->close(404, "");
+	ptree data = ToTree(bucket);
+	data.put("generation", bucket.from);
+
+	// Response
+	Response(session, data);
+}
+
+void RealTimeInfoHook::FitnessStreamHandler(const Ptr<restbed::Session> session) {
+	const auto request = session->get_request();
+	auto history = atomic_load(&mHistory);
+	if (!history) {
+		session->close(503, "");
+		return;
+	}
+	FitnessHistory::Bucket last;
+	ullong next = history->GetLast(last) ? last.from + 1 : 0;
+
+	// Parsing
+	try {
+		if (request->has_query_parameter("from"))
+			next = stoull(request->get_query_parameter("from"));
+		string lastId = request->get_header("Last-Event-ID", "");
+		if (lastId != "")
+			next = stoull(lastId) + 1;
+	} catch (exception&) {
+		session->close(400, "");
 		return;
 	}
 
-	FitnessRecord record = mFitnessRecords[at - mStartGen];
+	session->yield(OK, "", { {"Content-Type", "text/event-stream"},
+		{"Cache-Control", "no-cache"}, {"Connection", "keep-alive"} },
+		[this, next] (const Ptr<restbed::Session> pSession) {
+			{
+				lock_guard<mutex> lock(mStreamMutex);
+				mStreams.push_back({ pSession, next });
+			}
+			PushStreams();
+		});
+}
+
+/**
+ * Get the execution time statistics of every phase so far (given by \tt{/timings}).
+ * @return The statistics, or an empty tree if the evolution is not running.
+ */
+ptree RealTimeInfoHook::GetTimings() const {
+	SessionPtr eaSession = mSession;
+	if (!eaSession)
+		return ptree();
+
+	auto putRecord = [] (const ea::Session::TimeRecord& pRecord) {
+		ptree data;
+		data.put("count", pRecord.count);
+		data.put("total", pRecord.total);
+		data.put("average", pRecord.average);
+		data.put("p50", pRecord.p50);
+		data.put("p90", pRecord.p90);
+		data.put("p99", pRecord.p99);
+		data.put("max", pRecord.max);
+		if (pRecord.counted > 0)
+			for (uint i = 0; i < PerfCounters::NUM_EVENTS; i++)
+				data.put(string("counters.") + PerfCounters::GetName(i), pRecord.counters[i] / (double)pRecord.counted);
+		return data;
+	};
+
+	ptree phases;
+	for (auto& record : eaSession->GetTimeRecords(eaSession->GetStrategy()->GetTimeRecordOrder()))
+		phases.push_back(make_pair(record.id, putRecord(record)));
+
+	ptree data;
+	data.put_child("phases", phases);
+	data.put_child("total", putRecord(eaSession->GetTotalTimeRecord()));
+	return data;
+}
+
+/**
+ * Get the number of evaluations and generations per second (given by \tt{/throughput}).
+ * The generation and evaluation numbers are the ones of the last generation.
+ * The overall rates only count the generations and evaluations done since the evolution (re)started.
+ * @return The throughput statistics.
+ */
+ptree RealTimeInfoHook::GetThroughput() const {
+	ullong count = mProgressCount.load(memory_order_acquire);
+	float elapsed = GetElapsedTime();
+
 	ptree data;
-	data.put("generation", at);
-	data.put("max", record.max);
-	data.put("min", record.min);
-	data.put("mean", record.mean);
-	data.put("sd", record.sd);
+	data.put("generation", mStartGen);
+	data.put("evaluation", mStartEval);
+	data.put("elapsed", elapsed);
+
+	// The Population is only accessible by the evolution thread, so the counters are read from the progress samples
+	if (count > 0) {
+		const ProgressSample& last = mProgress[(count - 1) % PROGRESS_SAMPLES];
+		double lastTime = last.time.load(memory_order_relaxed) / 1e9;
+		ullong lastGen = last.generation.load(memory_order_relaxed);
+		ullong lastEval = last.evaluation.load(memory_order_relaxed);
+		data.put("generation", lastGen);
+		data.put("evaluation", lastEval);
+
+		if (lastTime > 0) {
+			data.put("evaluations-per-second", (lastEval - mStartEval) / lastTime);
+			data.put("generations-per-second", (lastGen - mStartGen) / lastTime);
+		}
+
+		// Over the last generations
+		ullong window = min<ullong>(count - 1, EA_REALTIMEINFO_PROGRESS_WINDOW);
+		if (window > 0) {
+			const ProgressSample& first = mProgress[(count - 1 - window) % PROGRESS_SAMPLES];
+			double time = lastTime - first.time.load(memory_order_relaxed) / 1e9;
+			if (time > 0) {
+				data.put("recent.evaluations-per-second", (lastEval - first.evaluation.load(memory_order_relaxed)) / time);
+				data.put("recent.generations-per-second", (lastGen - first.generation.load(memory_order_relaxed)) / time);
+				data.put("recent.generations", window);
+			}
+		}
+	}
+	return data;
+}
+
+/**
+ * Get the busy time and utilisation of every thread since the evolution started (given by \tt{/threads}).
+ * @return The thread statistics.
+ */
+ptree RealTimeInfoHook::GetThreads() const {
+	float elapsed = GetElapsedTime();
+	auto stats = MultiThreading::GetThreadStats();
+
+	ptree threads;
+	float totalBusy = 0;
+	for (uint i = 0; i < stats.size(); i++) {
+		ullong loops = stats[i].loops;
+		float busy = stats[i].busyTime;
+		if (i < mStartThreadStats.size()) {
+			loops -= mStartThreadStats[i].loops;
+			busy -= mStartThreadStats[i].busyTime;
+		}
+		totalBusy += busy;
+
+		ptree thread;
+		thread.put("thread", i);
+		thread.put("loops", loops);
+		thread.put("busy", busy);
+		thread.put("utilisation", elapsed > 0 ? busy / elapsed : 0);
+		threads.push_back(make_pair("", thread));
+	}
+
+	ptree data;
+	data.put("threads", stats.size());
+	data.put("elapsed", elapsed);
+	data.put("utilisation", elapsed > 0 && !stats.empty() ? totalBusy / (elapsed * stats.size()) : 0);
+	data.put_child("per-thread", threads);
+	return data;
+}
+
+/**
+ * Get the tasks, transferred bytes and utilisation of every cluster slave node
+ * since the evolution started (given by \tt{/cluster}).
+ * @return The cluster statistics.
+ */
+ptree RealTimeInfoHook::GetCluster() const {
+	float elapsed = GetElapsedTime();
+	auto stats = Cluster::GetWorkerStats();
+
+	ptree workers;
+	for (uint i = 0; i < stats.size(); i++) {
+		Cluster::WorkerStats worker = stats[i];
+		if (i < mStartWorkerStats.size()) {
+			worker.tasks -= mStartWorkerStats[i].tasks;
+			worker.bytesSent -= mStartWorkerStats[i].bytesSent;
+			worker.bytesReceived -= mStartWorkerStats[i].bytesReceived;
+			worker.busyTime -= mStartWorkerStats[i].busyTime;
+		}
+
+		ptree data;
+		data.put("rank", worker.rank);
+		data.put("tasks", worker.tasks);
+		data.put("sent", worker.bytesSent);
+		data.put("received", worker.bytesReceived);
+		data.put("busy", worker.busyTime);
+		data.put("utilisation", elapsed > 0 ? worker.busyTime / elapsed : 0);
+		workers.push_back(make_pair("", data));
+	}
+
+	ptree data;
+	data.put("enabled", Cluster::IsEnabled());
+	data.put("workers", stats.size());
+	data.put("elapsed", elapsed);
+	data.put_child("per-worker", workers);
+	return data;
+}
+
+void RealTimeInfoHook::TimingsHandler(const Ptr<restbed::Session> session) {
+	ptree data = GetTimings();
+	if (data.empty()) {
+		session->close(503, "");
+		return;
+	}
+
+	// Response
+	Response(session, data);
+}
+
+void RealTimeInfoHook::ThroughputHandler(const Ptr<restbed::Session> session) {
+	ptree data = GetThroughput();
+
+	// Response
+	Response(session, data);
+}
+
+void RealTimeInfoHook::ThreadsHandler(const Ptr<restbed::Session> session) {
+	ptree data = GetThreads();
 
 	// Response
 	Response(session, data);
 }
 
+void RealTimeInfoHook::ClusterHandler(const Ptr<restbed::Session> session) {
+	ptree data = GetCluster();
+
+	// Response
+	Response(session, data);
+}
+
+void RealTimeInfoHook::MemoryHandler(const Ptr<restbed::Session> session) {
+	if (!ObjectCounter::IsEnabled()) {
+		session->close(404, "");
+		return;
+	}
+	if (!atomic_load(&mHistory)) {
+		session->close(503, "");
+		return;
+	}
+
+	// The report is collected by the evolution thread at the end of the current generation
+	lock_guard<mutex> lock(mMemoryMutex);
+	mMemoryRequests.push_back(session);
+	mMemoryRequested.store(true, memory_order_release);
+}
+
 }
@@ -9,6 +9,10 @@
 
 #include "../../EA/Core.h"
 #include "../../EA/Utility.h"
+#include "FitnessHistory.h"
+#include <condition_variable>
+#include <deque>
+#include <list>
 #include <restbed>
 #include <boost/property_tree/ptree.hpp>
 
@@ -17,6 +21,7 @@ namespace ea {
 using namespace restbed;
 
 #define EA_REALTIMEINFO_DEFAULT_RESOLUTION	100
+#define EA_REALTIMEINFO_PROGRESS_WINDOW		16
 
 class RealTimeInfoHook : public Hook {
 public:
@@ -26,6 +31,12 @@ public:
 	virtual ~RealTimeInfoHook();
 
 	uint GetPort();
+	void SetHistory(uint pSize, uint pFactor = FitnessHistory::DEFAULT_FACTOR);
+
+	boost::property_tree::ptree GetTimings() const;
+	boost::property_tree::ptree GetThroughput() const;
+	boost::property_tree::ptree GetThreads() const;
+	boost::property_tree::ptree GetCluster() const;
 
 protected:
 	virtual void DoStart() override;
@@ -39,19 +50,65 @@ private:
 	thread mThread;
 
 	ullong mStartGen;
-
-	struct FitnessRecord {
-		double max, min, mean, sd;
+	ullong mStartEval;
+	SessionPtr mSession;
+	chrono::steady_clock::time_point mStartTime;
+	vector<MultiThreading::ThreadStats> mStartThreadStats;
+	vector<Cluster::WorkerStats> mStartWorkerStats;
+
+	struct ProgressSample {
+		atomic<ullong> time;		// ns since start
+		atomic<ullong> generation;
+		atomic<ullong> evaluation;
 	};
-	vector<FitnessRecord> mFitnessRecords;
+	static const uint PROGRESS_SAMPLES = 64;
+	ProgressSample mProgress[PROGRESS_SAMPLES];
+	atomic<ullong> mProgressCount;
+
+	uint mHistorySize;
+	uint mHistoryFactor;
+	// Only exists while the evolution runs (the handlers access it atomically)
+	Ptr<FitnessHistory> mHistory;
+
+	// Fitness values waiting for the statistics thread
+	thread mStatsThread;
+	mutex mQueueMutex;
+	condition_variable mQueueCondition;
+	deque<pair<ullong, vector<double>>> mQueue;
+	bool mStopping;
+
+	struct Stream {
+		Ptr<restbed::Session> session;
+		ullong next;
+	};
+	mutex mStreamMutex;
+	list<Stream> mStreams;
+
+	// Memory requests waiting for the report of the current generation
+	mutex mMemoryMutex;
+	vector<Ptr<restbed::Session>> mMemoryRequests;
+	atomic<bool> mMemoryRequested;
 
 	void ConfigurateResources();
+	void StatsRoutine();
+	void PushStreams();
+	void AddRecord(ullong pGeneration, const vector<double>& pValues);
+	static boost::property_tree::ptree ToTree(const FitnessHistory::Bucket& pBucket);
+	static boost::property_tree::ptree ToTree(const ObjectCounter::Report& pReport);
+	static string ToJSON(const boost::property_tree::ptree& pData);
 
 	void Response(const Ptr<restbed::Session>& session, boost::property_tree::ptree &data);
+	float GetElapsedTime() const;
 
 	void StatusHandler(const Ptr<restbed::Session> session);
 	void FitnessHandler(const Ptr<restbed::Session> session);
 	void FitnessAtHandler(const Ptr<restbed::Session> session);
+	void FitnessStreamHandler(const Ptr<restbed::Session> session);
+	void TimingsHandler(const Ptr<restbed::Session> session);
+	void ThroughputHandler(const Ptr<restbed::Session> session);
+	void ThreadsHandler(const Ptr<restbed::Session> session);
+	void ClusterHandler(const Ptr<restbed::Session> session);
+	void MemoryHandler(const Ptr<restbed::Session> session);
 };
 
 }
@@ -25,6 +25,9 @@ using namespace std;
  * with the number of generations and evaluations as the attributes respectively.
  *
  * Child classes should override the GetValue() to provide the value of the attribute.
+ *
+ * The starting value and the speed are saved in back-ups (see Checkpointable), so the tracker of a
+ * restored run continues from where the original run was instead of starting over.
  */
 
 /**
@@ -45,12 +48,30 @@ using namespace std;
 InformedTerminationHook::InformedTerminationHook(ullong pTarget, bool pInform,
 		string pUnit, string pShort, string pChar) :
 		mInform(pInform), mUnit(pUnit), mShort(pShort), mChar(pChar), mTarget(
-				pTarget), mStartValue(0), mSpeed(0), mLastValue(0), mLastTime() {
+				pTarget), mStartValue(0), mSpeed(0), mRestored(false), mLastValue(0), mLastTime() {
 }
 
 InformedTerminationHook::~InformedTerminationHook() {
 }
 
+/**
+ * Save the starting value and the current speed of the tracker.
+ * @param pStream The output stream.
+ */
+void InformedTerminationHook::SaveState(ostream& pStream) {
+	pStream << mStartValue << ' ' << mSpeed;
+}
+
+/**
+ * Load the starting value and the speed saved by SaveState().
+ * The loaded starting value is kept when the evolution starts.
+ * @param pStream The input stream.
+ */
+void InformedTerminationHook::LoadState(istream& pStream) {
+	pStream >> mStartValue >> mSpeed;
+	mRestored = true;
+}
+
 void InformedTerminationHook::UpdateSpeed() {
 	auto current = chrono::high_resolution_clock::now();
 	ullong currentValue = GetValue();
@@ -124,9 +145,12 @@ void InformedTerminationHook::Display() {
 
 void InformedTerminationHook::DoStart() {
 	if (mInform) {
-		mLastValue = mStartValue = GetValue();
+		mLastValue = GetValue();
+		if (!mRestored)
+			mStartValue = mLastValue;
 		mLastTime = chrono::high_resolution_clock::now();
 	}
+	mRestored = false;
 }
 
 void InformedTerminationHook::DoGenerational() {
@@ -10,16 +10,20 @@
 
 #include "../../EA/Type/Core.h"
 #include "../../core/interface/Hook.h"
+#include "../../core/interface/Checkpointable.h"
 #include <chrono>
 
 namespace ea {
 
-class InformedTerminationHook: public Hook {
+class InformedTerminationHook: public Hook, public Checkpointable {
 public:
 	InformedTerminationHook(ullong pTarget, bool pInform, string pUnit,
 			string pShort, string pChar);
 	virtual ~InformedTerminationHook();
 
+	virtual void SaveState(ostream& pStream) override;
+	virtual void LoadState(istream& pStream) override;
+
 protected:
 	bool mInform;
 
@@ -34,6 +38,7 @@ private:
 	ullong mTarget;
 	ullong mStartValue;
 	float mSpeed;
+	bool mRestored;
 
 	ullong mLastValue;
 	chrono::time_point<chrono::high_resolution_clock> mLastTime;
@@ -0,0 +1,137 @@
+/*
+ * BitWords.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../Common.h"
+#include <climits>
+
+/**
+ * Defined when the machine words of a vector<bool> can be accessed directly (i.e. with libstdc++).
+ * The operators on BoolArrayGenome use the word-level paths of BitWords only if it is defined,
+ * and fall back to the bit-by-bit paths otherwise. Define EA_NO_BIT_WORDS to disable it.
+ */
+#if defined(__GLIBCXX__) && !defined(EA_NO_BIT_WORDS)
+#define EA_BIT_WORDS
+#endif
+
+namespace ea {
+
+using namespace std;
+
+#ifdef EA_BIT_WORDS
+/**
+ * Static class which gives access to the machine words storing the bits of a vector<bool>.
+ * It allows the operators on BoolArrayGenome to process a whole word of genes in one instruction.
+ * The bit \f$i\f$ of a vector is the bit \f$i \bmod B\f$ of the word \f$\lfloor i / B \rfloor\f$,
+ * where \f$B\f$ is BitWords::BITS.
+ *
+ * The bits of the last word beyond the size of the vector are unused. Their value is unspecified
+ * (copying a vector<bool> does not copy them), so they must be masked out when reading a word
+ * and left unchanged when writing one (see LastMask()).
+ *
+ * This class is only available if EA_BIT_WORDS is defined.
+ */
+class BitWords {
+public:
+	/** The type of the words of a vector<bool>. */
+	typedef _Bit_type Word;
+
+	/** The number of bits in a Word. */
+	static const uint BITS = sizeof(Word) * CHAR_BIT;
+
+	/**
+	 * Get the words of a vector<bool>.
+	 * @param pBits The vector.
+	 * @return The pointer to the first word.
+	 */
+	static inline Word* Get(vector<bool>& pBits) {
+		return pBits.begin()._M_p;
+	}
+
+	/**
+	 * Get the words of a constant vector<bool>.
+	 * @param pBits The vector.
+	 * @return The pointer to the first word.
+	 */
+	static inline const Word* Get(const vector<bool>& pBits) {
+		return pBits.begin()._M_p;
+	}
+
+	/**
+	 * Get the number of words storing a number of bits.
+	 * @param pSize The number of bits.
+	 * @return The number of words.
+	 */
+	static inline size_t Count(size_t pSize) {
+		return (pSize + BITS - 1) / BITS;
+	}
+
+	/**
+	 * Get the mask of the used bits of the last word.
+	 * @param pSize The number of bits (must be positive).
+	 * @return The mask whose bits are set for the bits of the last word which belong to the vector.
+	 */
+	static inline Word LastMask(size_t pSize) {
+		return ~Word(0) >> ((BITS - pSize % BITS) % BITS);
+	}
+
+	/**
+	 * Blend two words.
+	 * @param pWord The first word.
+	 * @param pOther The second word.
+	 * @param pMask The mask of the bits to take from the second word.
+	 * @return The bits of the first word where the mask is clear and of the second word where it is set.
+	 */
+	static inline Word Blend(Word pWord, Word pOther, Word pMask) {
+		return pWord ^ ((pWord ^ pOther) & pMask);
+	}
+
+	/**
+	 * Flip all the bits of a vector<bool>.
+	 * Unlike vector<bool>::flip(), the unused bits of the last word are left unchanged.
+	 * @param pBits The vector.
+	 */
+	static inline void Flip(vector<bool>& pBits) {
+		if (pBits.empty())
+			return;
+
+		Word* words = Get(pBits);
+		size_t count = Count(pBits.size());
+		for (size_t i = 0; i + 1 < count; i++)
+			words[i] = ~words[i];
+		words[count - 1] ^= LastMask(pBits.size());
+	}
+
+	/**
+	 * Copy a range of bits from a vector<bool> to another one.
+	 * The other bits of the destination are unchanged.
+	 * @param pDestination The destination vector.
+	 * @param pSource The source vector.
+	 * @param pBegin The first bit of the range.
+	 * @param pEnd The end of the range (must not exceed the size of both vectors).
+	 */
+	static inline void Copy(vector<bool>& pDestination, const vector<bool>& pSource, size_t pBegin, size_t pEnd) {
+		if (pBegin >= pEnd)
+			return;
+
+		Word* destination = Get(pDestination);
+		const Word* source = Get(pSource);
+		size_t first = pBegin / BITS, last = (pEnd - 1) / BITS;
+		Word firstMask = ~Word(0) << (pBegin % BITS);
+		if (first == last) {
+			destination[first] = Blend(destination[first], source[first], firstMask & LastMask(pEnd));
+			return;
+		}
+		destination[first] = Blend(destination[first], source[first], firstMask);
+		copy(source + first + 1, source + last, destination + first + 1);
+		destination[last] = Blend(destination[last], source[last], LastMask(pEnd));
+	}
+};
+#endif
+
+} /* namespace ea */
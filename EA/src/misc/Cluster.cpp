@@ -15,6 +15,19 @@ bool Cluster::sEnabled = false;
 vector<Cluster::ClusterFunction> Cluster::sOperators;
 Cluster::ClusterFunction Cluster::sCurrentOp;
 
+#ifndef DOXYGEN_IGNORE
+struct Cluster::WorkerCounters {
+	atomic<ullong> tasks;
+	atomic<ullong> bytesSent;
+	atomic<ullong> bytesReceived;
+	atomic<ullong> busyNanos;
+	chrono::steady_clock::time_point sentTime;
+};
+#endif
+
+unique_ptr<Cluster::WorkerCounters[]> Cluster::sWorkers;
+atomic<uint> Cluster::sNumWorkers(0);
+
 /**
  * @class Cluster
  * Static class providing cluster computation feature.
@@ -52,6 +65,9 @@ Cluster::ClusterFunction Cluster::sCurrentOp;
  * openea edit cluster
  * @endcode
  *
+ * While the cluster is running, the master node counts the tasks, the transferred bytes and the busy time
+ * of every slave node, which can be queried by GetWorkerStats() (e.g. by RealTimeInfoHook).
+ *
  * @see ClusterComputable
  */
 
@@ -146,8 +162,53 @@ void Cluster::Deploy() {
 
 	if (rank != 0)
 		SlaveRoutine();
-	else
+	else {
+		sWorkers.reset(new WorkerCounters[size - 1]());
+		sNumWorkers.store(size - 1, memory_order_release);
 		EA_LOG_DEBUG << "Cluster deployed, size = " << size << flush;
+	}
+}
+
+/**
+ * @struct Cluster::WorkerStats
+ * Statistics of a slave node, counted by the master node.
+ */
+
+/**
+ * Get the statistics of every slave node.
+ * This function can be called from another thread while the cluster is computing.
+ * @return The statistics ordered by rank, or an empty list if the cluster has not been deployed.
+ */
+vector<Cluster::WorkerStats> Cluster::GetWorkerStats() {
+	vector<WorkerStats> result;
+	uint numWorkers = sNumWorkers.load(memory_order_acquire);
+	for (uint i = 0; i < numWorkers; i++) {
+		WorkerCounters& worker = sWorkers[i];
+		result.push_back({ i + 1, worker.tasks.load(memory_order_relaxed),
+			worker.bytesSent.load(memory_order_relaxed), worker.bytesReceived.load(memory_order_relaxed),
+			worker.busyNanos.load(memory_order_relaxed) / 1e6f });
+	}
+	return result;
+}
+
+void Cluster::RecordSend(int pRank, ullong pBytes) {
+	if (pRank < 1 || uint(pRank) > sNumWorkers.load(memory_order_relaxed))
+		return;
+
+	WorkerCounters& worker = sWorkers[pRank - 1];
+	worker.bytesSent.fetch_add(pBytes, memory_order_relaxed);
+	worker.sentTime = chrono::steady_clock::now();
+}
+
+void Cluster::RecordReceive(int pRank, ullong pBytes) {
+	if (pRank < 1 || uint(pRank) > sNumWorkers.load(memory_order_relaxed))
+		return;
+
+	WorkerCounters& worker = sWorkers[pRank - 1];
+	worker.busyNanos.fetch_add(chrono::duration_cast<chrono::nanoseconds>(
+			chrono::steady_clock::now() - worker.sentTime).count(), memory_order_relaxed);
+	worker.bytesReceived.fetch_add(pBytes, memory_order_relaxed);
+	worker.tasks.fetch_add(1, memory_order_relaxed);
 }
 
 void Cluster::AddOperatorBase(const Ptr<ClusterComputableBase>& pOp) {
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "../Common.h"
+#include <atomic>
 #include <csignal>
 #include "ClusterComputable.h"
 
@@ -25,6 +26,13 @@ private:
 	static vector<ClusterFunction> sOperators;
 	static ClusterFunction sCurrentOp;
 
+	struct WorkerCounters;
+	static unique_ptr<WorkerCounters[]> sWorkers;
+	static atomic<uint> sNumWorkers;
+
+	static void RecordSend(int pRank, ullong pBytes);
+	static void RecordReceive(int pRank, ullong pBytes);
+
 	static void SlaveRoutine();
 	static void AddOperatorBase(const Ptr<ClusterComputableBase>& pOp);
 
@@ -32,8 +40,17 @@ private:
 	static void Unload();
 
 public:
+	struct WorkerStats {
+		uint rank;				///< The MPI rank of the worker.
+		ullong tasks;			///< The number of tasks completed.
+		ullong bytesSent;		///< The number of bytes sent to the worker.
+		ullong bytesReceived;	///< The number of bytes received from the worker.
+		float busyTime;			///< The total time between sending a task and receiving its result (ms).
+	};
+
 	static void SetEnabled(bool pEnabled);
 	static bool IsEnabled();
+	static vector<WorkerStats> GetWorkerStats();
 
 	template <class T>
 	inline static void AddOperator(const Ptr<T>& pOp) {
@@ -11,6 +11,7 @@
 #include "Cluster.h"
 #include <mpi/mpi.h>
 #include "MultiThreading.h"
+#include "Tracer.h"
 #include "../rtoc/BinarySerializer.h"
 
 namespace ea {
@@ -38,12 +39,14 @@ inline vector<OutputT>
 
 		// First deployment
 		for (uint i = 0; i < sent; i++) {
+			Tracer::Scope trace("Cluster::Send", "cluster");
 			ostringstream oss(ios::binary);
 			BinarySerializer<InputT>::Write(oss, pInputArray[i]);
 			const string data = oss.str();
 			MPI_Send(data.c_str(), data.length(), MPI_BYTE,
 					i + 1, i + EA_CLUSTER_TAG_RESERVED,
 					MPI_COMM_WORLD);
+			Cluster::RecordSend(i + 1, data.length());
 		}
 
 		// Loop
@@ -56,23 +59,29 @@ inline vector<OutputT>
 			int count;
 			MPI_Get_count(&status, MPI_BYTE, &count);
 
-			char* buffer = new char[count];
-			MPI_Recv(buffer, count, MPI_BYTE, source, tag, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-
 			uint index = tag - EA_CLUSTER_TAG_RESERVED;
-			istringstream iss(string(buffer, count), ios::binary);
-			outputArray[index] = BinarySerializer<OutputT>::Read(iss);
+			{
+				Tracer::Scope trace("Cluster::Receive", "cluster");
+				char* buffer = new char[count];
+				MPI_Recv(buffer, count, MPI_BYTE, source, tag, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+				Cluster::RecordReceive(source, count);
+
+				istringstream iss(string(buffer, count), ios::binary);
+				outputArray[index] = BinarySerializer<OutputT>::Read(iss);
+			}
 
 			if (pCallback)
 				pCallback(index, pInputArray[index], outputArray[index]);
 
 			if (sent < size) {
+				Tracer::Scope trace("Cluster::Send", "cluster");
 				ostringstream oss(ios::binary);
 				BinarySerializer<InputT>::Write(oss, pInputArray[sent]);
 				const string data = oss.str();
 				MPI_Send(data.c_str(), data.length(), MPI_BYTE,
 						source, sent + EA_CLUSTER_TAG_RESERVED,
 						MPI_COMM_WORLD);
+				Cluster::RecordSend(source, data.length());
 				sent++;
 			}
 		}
@@ -101,14 +110,19 @@ inline vector<OutputT>
 template <class InputT, class OutputT>
 Cluster::ClusterFunction ClusterComputable<InputT, OutputT>::SlaveFunction() {
 	return [this] (int count, int tag) {
-		char* buffer = new char[count];
-		MPI_Recv(buffer, count, MPI_BYTE, 0, tag, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+		InputT input;
+		{
+			Tracer::Scope trace("Cluster::Receive", "cluster");
+			char* buffer = new char[count];
+			MPI_Recv(buffer, count, MPI_BYTE, 0, tag, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
 
-		istringstream iss(string(buffer, count), ios::binary);
-		InputT input = BinarySerializer<InputT>::Read(iss);
+			istringstream iss(string(buffer, count), ios::binary);
+			input = BinarySerializer<InputT>::Read(iss);
+		}
 
 		OutputT output = ProcessOnRemote(input);
 
+		Tracer::Scope trace("Cluster::Send", "cluster");
 		ostringstream oss(ios::binary);
 		BinarySerializer<OutputT>::Write(oss, output);
 		const string data = oss.str();
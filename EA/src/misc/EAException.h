@@ -119,7 +119,8 @@ public:
 		WRONG_DATA_CATEGORY,					///< This UnifiedData contains another category of data (string or object).
 		BINARY_WRITE_BAD_CAST = 0x140,			///< Bad casting happened when calling BinarySerializer::Write().
 		BINARY_READ_BAD_CAST,					///< Bad casting happened when calling BinarySerializer::Read().
-		STORABLE_NO_TYPE_NAME					///< This Storable class doesn't define a type name.
+		STORABLE_NO_TYPE_NAME,					///< This Storable class doesn't define a type name.
+		BINARY_READ_BAD_TYPE_ID					///< The type ID read by TypeDictionary is not defined.
 	};
 
 	RTOCException(int pCode, string pMessage, exception_ptr pInner = nullptr);
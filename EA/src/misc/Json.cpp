@@ -0,0 +1,37 @@
+/*
+ * Json.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../pch.h"
+#include "Json.h"
+
+namespace ea {
+
+/**
+ * @class Json
+ * Static class with helpers for the JSON files written by the library (see Tracer and BenchmarkHook).
+ */
+
+/**
+ * Write a string as a quoted JSON string.
+ * Quotes and backslashes are escaped, and control characters are written as unicode escapes.
+ * @param pStream The output stream.
+ * @param pStr The string to be written.
+ */
+void Json::WriteString(ostream& pStream, const string& pStr) {
+	pStream << '"';
+	for (char c : pStr) {
+		if (c == '"' || c == '\\')
+			pStream << '\\' << c;
+		else if ((unsigned char)c < 0x20)
+			pStream << "\\u" << hex << setw(4) << setfill('0') << int(c) << dec << setfill(' ');
+		else
+			pStream << c;
+	}
+	pStream << '"';
+}
+
+} /* namespace ea */
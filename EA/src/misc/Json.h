@@ -0,0 +1,21 @@
+/*
+ * Json.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../Common.h"
+
+namespace ea {
+
+using namespace std;
+
+class Json {
+public:
+	static void WriteString(ostream& pStream, const string& pStr);
+};
+
+} /* namespace ea */
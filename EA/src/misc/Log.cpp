@@ -15,12 +15,17 @@
 #include <boost/log/utility/setup/common_attributes.hpp>
 #include <boost/log/utility/setup/console.hpp>
 #include <boost/log/utility/setup/file.hpp>
+#include <boost/log/utility/setup/formatter_parser.hpp>
 
 #include <boost/algorithm/string/split.hpp>
 #include <boost/algorithm/string/classification.hpp>
 
 #include "Log_private.h"
 
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
 namespace logging = boost::log;
 namespace src = boost::log::sources;
 namespace keywords = boost::log::keywords;
@@ -31,6 +36,96 @@ using namespace std;
 namespace ea {
 
 #ifndef DOXYGEN_IGNORE
+// File target which is written by a background thread.
+// The records are appended to a buffer and written (then flushed) in batches,
+// so the logging threads never wait for the file system.
+class AsyncFileBackend: public sinks::basic_formatted_sink_backend<char,
+		sinks::combine_requirements<sinks::concurrent_feeding, sinks::flushing>::type> {
+public:
+	// Size of the buffer which wakes up the writer before the next period
+	static const size_t BATCH_SIZE = 64 * 1024;
+	// Maximum time a record stays in the buffer
+	static constexpr chrono::milliseconds PERIOD { 100 };
+
+	AsyncFileBackend(const string& pFile) :
+			mFile(pFile, ios_base::out | ios_base::app), mMutex(), mCondition(), mWritten(), mBuffer(),
+			mQueued(0), mWrittenCount(0), mFlushing(false), mStopping(false), mThread() {
+		if (!mFile)
+			throw runtime_error("Log: Cannot open \"" + pFile + "\" for writing.");
+		mThread = thread(&AsyncFileBackend::WriterRoutine, this);
+	}
+
+	~AsyncFileBackend() {
+		{
+			lock_guard<mutex> lock(mMutex);
+			mStopping = true;
+		}
+		mCondition.notify_one();
+		mThread.join();
+	}
+
+	void consume(const logging::record_view&, const string& pMessage) {
+		bool full;
+		{
+			lock_guard<mutex> lock(mMutex);
+			mBuffer.append(pMessage).push_back('\n');
+			mQueued++;
+			full = mBuffer.size() >= BATCH_SIZE;
+		}
+		if (full)
+			mCondition.notify_one();
+	}
+
+	// Wait until every record consumed so far is written
+	void flush() {
+		unique_lock<mutex> lock(mMutex);
+		unsigned long long target = mQueued;
+		mFlushing = true;
+		mCondition.notify_one();
+		mWritten.wait(lock, [this, target] () { return mWrittenCount >= target; });
+	}
+
+private:
+	ofstream mFile;
+	mutex mMutex;
+	condition_variable mCondition;
+	condition_variable mWritten;
+	string mBuffer;
+	unsigned long long mQueued;
+	unsigned long long mWrittenCount;
+	bool mFlushing;
+	bool mStopping;
+	thread mThread;
+
+	void WriterRoutine() {
+		string batch;
+		unique_lock<mutex> lock(mMutex);
+		while (true) {
+			mCondition.wait_for(lock, PERIOD, [this] () {
+				return mStopping || mFlushing || mBuffer.size() >= BATCH_SIZE;
+			});
+			bool stopping = mStopping;
+			unsigned long long count = mQueued;
+			mFlushing = false;
+			batch.swap(mBuffer);
+			lock.unlock();
+
+			if (!batch.empty()) {
+				mFile.write(batch.data(), batch.size());
+				mFile.flush();
+				batch.clear();
+			}
+
+			lock.lock();
+			mWrittenCount = count;
+			mWritten.notify_all();
+			if (stopping && mBuffer.empty())
+				break;
+		}
+	}
+};
+constexpr chrono::milliseconds AsyncFileBackend::PERIOD;
+
 BOOST_LOG_INLINE_GLOBAL_LOGGER_DEFAULT(EALogger,
 		src::severity_logger_mt<Log::SeverityLevel>);
 
@@ -38,6 +133,7 @@ src::severity_logger_mt<Log::SeverityLevel> Log::sLogger = EALogger::get();
 vector<boost::shared_ptr<sinks::sink>> Log::mSinks[Log::SeverityLevel_MAX + 1] =
 		{ };
 uint Log::sNumSinks = 0;
+atomic<uint> Log::sEnabledLevels(0);
 
 const string Log::NoOutput("");
 
@@ -53,6 +149,9 @@ Log::InitStruct::InitStruct() {
 	logging::add_console_log(cout,
 			keywords::filter = (severity > SeverityLevel_MAX));
 }
+Log::InitStruct::~InitStruct() {
+	Flush();
+}
 Log::InitStruct Log::__init;
 #endif
 
@@ -74,11 +173,13 @@ void Log::Default(SeverityLevel pLevel) {
 void Log::Clear(SeverityLevel pLevel) {
 	for (auto sink : mSinks[pLevel]) {
 		logging::core::get()->remove_sink(sink);
+		sink->flush();
 		sNumSinks--;
 		if (!sNumSinks)
 			logging::core::get()->set_logging_enabled(false);
 	}
 	mSinks[pLevel].clear();
+	UpdateEnabledLevels();
 }
 
 void Log::Redirect(SeverityLevel pLevel, string pFile) {
@@ -91,6 +192,13 @@ void Log::Add(SeverityLevel pLevel, string pFile) {
 	boost::algorithm::split(targets, pFile, boost::algorithm::is_any_of(","));
 	for (string target : targets)
 		AddSink(pLevel, target);
+	UpdateEnabledLevels();
+}
+
+void Log::Flush() {
+	for (auto& sinks : mSinks)
+		for (auto& sink : sinks)
+			sink->flush();
 }
 
 #ifndef DOXYGEN_IGNORE
@@ -125,18 +233,32 @@ void Log::AddSink(SeverityLevel pLevel, string pFile) {
 				keywords::auto_flush = true,
 				keywords::format = color + format + "\e[0m"));
 
-	else
-		mSinks[pLevel].push_back((boost::shared_ptr<sinks::sink>)logging::add_file_log(
-				pFile,
-				keywords::filter = (severity == pLevel),
-				keywords::open_mode = ios_base::app,
-				keywords::auto_flush = true,
-				keywords::format = format));
+	else {
+		// The levels redirected to the same file share the backend, so their records stay in order
+		static map<string, boost::weak_ptr<AsyncFileBackend>> backends;
+		auto backend = backends[pFile].lock();
+		if (!backend)
+			backends[pFile] = backend = boost::make_shared<AsyncFileBackend>(pFile);
+
+		auto sink = boost::make_shared<sinks::unlocked_sink<AsyncFileBackend>>(backend);
+		sink->set_filter(severity == pLevel);
+		sink->set_formatter(logging::parse_formatter(format));
+		logging::core::get()->add_sink(sink);
+		mSinks[pLevel].push_back(sink);
+	}
 
 	sNumSinks++;
 	logging::core::get()->set_logging_enabled(true);
 }
 
+void Log::UpdateEnabledLevels() {
+	uint levels = 0;
+	for (uint level = 0; level <= SeverityLevel_MAX; level++)
+		if (!mSinks[level].empty())
+			levels |= 1 << level;
+	sEnabledLevels.store(levels, memory_order_relaxed);
+}
+
 LogStreamBuf::LogStreamBuf(Log::SeverityLevel pLevel) :
 		mLevel(pLevel) {
 }
@@ -158,7 +280,7 @@ int LogStreamBuf::sync() {
 #endif
 
 LogStream::LogStream(Log::SeverityLevel pLevel) :
-		ostream(new LogStreamBuf(pLevel)) {
+		ostream(Log::IsEnabled(pLevel) ? new LogStreamBuf(pLevel) : nullptr) {
 }
 
 LogStream::~LogStream() {
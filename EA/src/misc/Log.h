@@ -8,6 +8,7 @@
 #pragma once
 
 #include "../Common.h"
+#include <atomic>
 
 namespace ea {
 
@@ -21,6 +22,10 @@ using namespace std;
  * Redirection functions include Redirect(), Clear(), Default() and Add().
  * To actually write a log record, please use LogStream.
  *
+ * A level without any target is disabled: the #EA_LOG macros check IsEnabled() before evaluating
+ * the message, so a disabled log record costs one load. The file targets are written
+ * asynchronously in batches by a background thread (see Flush()), the console targets are written immediately.
+ *
  * @see LogStream
  * @see Log::SeverityLevel
  * @see Redirect()
@@ -71,11 +76,29 @@ public:
 	 * @param pFile The target of redirection.
 	 */
 	static void Add(SeverityLevel pLevel, string pFile);
+	/**
+	 * Write all the pending log records to their file targets.
+	 * The file targets are written in batches by a background thread, this function waits until they are written.
+	 * It is called automatically when a target is cleared and at exit.
+	 */
+	static void Flush();
+
+	/**
+	 * Check whether the given level has at least one target.
+	 * @param pLevel The log level to be checked.
+	 * @return true if the log records of the level are written somewhere.
+	 */
+	static inline bool IsEnabled(SeverityLevel pLevel) {
+		return (sEnabledLevels.load(memory_order_relaxed) >> pLevel) & 1;
+	}
 
 	/**
 	 * Constant string equivalent to empty string "".
 	 */
 	static const string NoOutput;
+
+private:
+	static atomic<uint> sEnabledLevels;
 };
 
 /**
@@ -89,6 +112,12 @@ public:
  * - #EA_LOG_DEBUG : Open LogStream at Log::DEBUG level.
  * - #EA_LOG_INFO : Open LogStream at Log::INFO level.
  * - #EA_LOG_ERROR : Open LogStream at Log::ERROR level.
+ *
+ * The macros do not evaluate the message when the level is disabled (see Log::IsEnabled()).
+ * The levels below #EA_LOG_MIN_LEVEL are removed at compile time: defining \tt{NDEBUG} (or
+ * \tt{EA_LOG_MIN_LEVEL=1}) strips all the TRACE records from a release build.
+ * A LogStream created directly at a disabled level ignores its input.
+ *
  * Example of using macros:
  *
  * @code
@@ -105,7 +134,25 @@ public:
 	~LogStream();
 };
 
-#define EA_LOG(LEVEL) ea::LogStream(ea::Log::LEVEL)
+#ifndef DOXYGEN_IGNORE
+// Turns the stream expression of the macros into void, so that it can be used in a conditional expression
+struct LogVoidify {
+	inline void operator&(ostream&) {
+	}
+};
+#endif
+
+#ifndef EA_LOG_MIN_LEVEL
+#ifdef NDEBUG
+#define EA_LOG_MIN_LEVEL 1
+#else
+#define EA_LOG_MIN_LEVEL 0
+#endif
+#endif
+
+#define EA_LOG(LEVEL) \
+	!(ea::Log::LEVEL >= EA_LOG_MIN_LEVEL && ea::Log::IsEnabled(ea::Log::LEVEL)) ? (void) 0 : \
+			ea::LogVoidify() & ea::LogStream(ea::Log::LEVEL)
 #define EA_LOG_TRACE EA_LOG(TRACE)
 #define EA_LOG_DEBUG EA_LOG(DEBUG)
 #define EA_LOG_INFO EA_LOG(INFO)
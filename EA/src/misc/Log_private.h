@@ -10,6 +10,7 @@
 
 #include <sstream>
 #include <iostream>
+#include <atomic>
 
 #include <boost/log/core.hpp>
 #include <boost/log/sinks.hpp>
@@ -36,12 +37,20 @@ public:
 	static void Default(SeverityLevel pLevel);
 	static void Redirect(SeverityLevel pLevel, string pFile);
 	static void Add(SeverityLevel pLevel, string pFile);
+	static void Flush();
+
+	static inline bool IsEnabled(SeverityLevel pLevel) {
+		return (sEnabledLevels.load(memory_order_relaxed) >> pLevel) & 1;
+	}
 
 	static const string NoOutput;
 
 private:
+	static atomic<uint> sEnabledLevels;
+
 	static struct InitStruct {
 		InitStruct();
+		~InitStruct();
 	} __init;
 
 	static vector<boost::shared_ptr<sinks::sink>> mSinks[SeverityLevel_MAX + 1];
@@ -49,6 +58,7 @@ private:
 	static uint sNumSinks;
 
 	static void AddSink(SeverityLevel pLevel, string pFile);
+	static void UpdateEnabledLevels();
 
 	friend class LogStreamBuf;
 };
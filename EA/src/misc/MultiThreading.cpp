@@ -6,9 +6,10 @@
  */
 
 #include "../pch.h"
+#include "../Common.h"
 #include "MultiThreading.h"
 #include "Cluster.h"
-#include "../Common.h"
+#include "Tracer.h"
 #include <omp.h>
 
 namespace ea {
@@ -16,6 +17,15 @@ namespace ea {
 uint MultiThreading::sNumThreads = 0;
 bool MultiThreading::sForced = false;
 
+#ifndef DOXYGEN_IGNORE
+struct alignas(64) MultiThreading::ThreadCounters {
+	atomic<ullong> loops;
+	atomic<ullong> busyNanos;
+};
+#endif
+
+MultiThreading::ThreadCounters MultiThreading::sThreadCounters[MAX_THREADS];
+
 /**
  * @class MultiThreading
  * Static class providing multi-threading feature.
@@ -28,6 +38,8 @@ bool MultiThreading::sForced = false;
  * of the CPU usage). If users deploy the cluster remotely and still have some CPU cores to spare,
  * multi-threading feature can be forced to be enabled by calling SetForceEnabled().
  *
+ * Each thread counts the time it spends in For(), which can be queried by GetThreadStats().
+ *
  * @see For()
  */
 
@@ -62,16 +74,31 @@ void MultiThreading::For(int pFrom, int pTo, function<void(int)> pFunc) {
 	atomic<bool> hasError(false);
 	exception_ptr excp;
 
-#pragma omp parallel for schedule(guided) if (sNumThreads != 1 && (!Cluster::IsEnabled() || sForced))
-	for (int i = pFrom; i < pTo; i++) {
-		if (hasError)
-			continue;
+#pragma omp parallel if (sNumThreads != 1 && (!Cluster::IsEnabled() || sForced))
+	{
+		Tracer::Scope trace("MultiThreading::For", "parallel");
+		auto start = chrono::steady_clock::now();
+
+#pragma omp for schedule(guided) nowait
+		for (int i = pFrom; i < pTo; i++) {
+			if (hasError)
+				continue;
+
+			try {
+				pFunc(i);
+			} catch (exception& e) {
+				hasError = true;
+				excp = current_exception();
+			}
+		}
 
-		try {
-			pFunc(i);
-		} catch (exception& e) {
-			hasError = true;
-			excp = current_exception();
+		// Several OS threads can share a thread number (nested or concurrent loops), so the counters are added atomically
+		uint thread = omp_get_thread_num();
+		if (thread < MAX_THREADS) {
+			ThreadCounters& counters = sThreadCounters[thread];
+			ullong nanos = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+			counters.loops.fetch_add(1, memory_order_relaxed);
+			counters.busyNanos.fetch_add(nanos, memory_order_relaxed);
 		}
 	}
 
@@ -79,6 +106,30 @@ void MultiThreading::For(int pFrom, int pTo, function<void(int)> pFunc) {
 		rethrow_exception(excp);
 }
 
+/**
+ * @struct MultiThreading::ThreadStats
+ * Statistics of a thread in For(), counted since the start of the program.
+ */
+
+/**
+ * Get the statistics of the threads executing For().
+ * Comparing the busy time of the threads shows the load balance, and comparing it with the elapsed time
+ * shows the thread utilisation. This function can be called from another thread while a loop is running.
+ * The statistics are kept per OpenMP thread number: loops started from several threads at once, or nested loops,
+ * add to the same thread numbers.
+ * @return The statistics ordered by OpenMP thread number, up to the highest thread which has executed a loop.
+ */
+vector<MultiThreading::ThreadStats> MultiThreading::GetThreadStats() {
+	vector<ThreadStats> result;
+	for (uint i = 0; i < MAX_THREADS; i++)
+		result.push_back({ sThreadCounters[i].loops.load(memory_order_relaxed),
+			sThreadCounters[i].busyNanos.load(memory_order_relaxed) / 1e6f });
+
+	while (!result.empty() && result.back().loops == 0)
+		result.pop_back();
+	return result;
+}
+
 /**
  * Get the maximum number of threads allowed when multi-threading.
  * The returned value of this function is identical to what is set in SetNumThreads().
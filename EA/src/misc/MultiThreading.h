@@ -13,7 +13,13 @@ using namespace std;
 
 class MultiThreading {
 public:
+	struct ThreadStats {
+		ullong loops;		///< The number of MultiThreading::For() calls the thread took part in.
+		float busyTime;		///< The total time the thread spent executing loop iterations (ms).
+	};
+
 	static void For(int pFrom, int pTo, function<void(int)> pFunc);
+	static vector<ThreadStats> GetThreadStats();
 
 	static uint GetNumThreads();
 	static uint GetRealNumThreads();
@@ -25,6 +31,10 @@ public:
 private:
 	static uint sNumThreads;
 	static bool sForced;
+
+	static const uint MAX_THREADS = 256;
+	struct ThreadCounters;
+	static ThreadCounters sThreadCounters[MAX_THREADS];
 };
 
 } /* namespace ea */
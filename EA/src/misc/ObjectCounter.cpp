@@ -0,0 +1,216 @@
+/*
+ * ObjectCounter.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../pch.h"
+#include "ObjectCounter.h"
+#include "../core/Population.h"
+#include "../core/Organism.h"
+#include "../core/interface/Genome.h"
+#include "../core/interface/Fitness.h"
+#include "../core/pool/OrganismPool.h"
+#include "../core/pool/GenomePool.h"
+#include "../core/pool/MetaPool.h"
+#include <typeindex>
+
+namespace ea {
+
+/**
+ * @class ObjectCounter
+ * Static class accounting the objects and the memory used by the evolution.
+ * It answers which structure grows when a run uses more memory than expected:
+ * - When enabled, the constructors and destructors of Organism, Genome and Fitness count their live instances
+ * in the whole process (see GetLive()). Instances which are not reachable from the Population are
+ * held elsewhere (e.g. by a Hook or leaked).
+ * - Collect() walks the pools of a Population and reports the reachable organisms, the genomes by type,
+ * the Fitness objects and every pool with their footprint in bytes (see Genome::GetMemoryUsage()
+ * and Fitness::GetMemoryUsage()). Objects shared by several pools are counted once.
+ *
+ * MemoryReportHook logs the report every generation and RealTimeInfoHook publishes it at \tt{/memory}.
+ *
+ * When disabled (the default), the constructors only load one flag and Collect() is never called, so the
+ * accounting costs nothing. The live counts only include the instances created while enabled, so it should be enabled
+ * before the Population is created (MemoryReportHook enables it when it is constructed).
+ *
+ * @method
+ * The live counts are striped over several cache lines (one per thread, round-robin),
+ * so the threads creating genomes in parallel do not contend on the same counter.
+ *
+ * @code
+ * ObjectCounter::SetEnabled(true);
+ * strategy->Evolve();
+ * @endcode
+ *
+ * @see MemoryReportHook
+ */
+
+atomic<bool> ObjectCounter::sEnabled(false);
+
+#ifndef DOXYGEN_IGNORE
+struct alignas(64) CounterSlot {
+	atomic<llong> values[ObjectCounter::NUM_KINDS];
+};
+
+static const uint NUM_SLOTS = 16;
+static CounterSlot sSlots[NUM_SLOTS];
+static atomic<uint> sNextSlot(0);
+#endif
+
+/**
+ * Enable or disable the counting of live instances.
+ * @param pEnabled true to count the live instances.
+ */
+void ObjectCounter::SetEnabled(bool pEnabled) {
+	sEnabled.store(pEnabled, memory_order_relaxed);
+}
+
+/**
+ * Get the number of live instances of a kind.
+ * @param pKind The kind of the instances.
+ * @return The number of instances created minus the number of instances destroyed while enabled.
+ */
+llong ObjectCounter::GetLive(Kind pKind) {
+	llong sum = 0;
+	for (auto& slot : sSlots)
+		sum += slot.values[pKind].load(memory_order_relaxed);
+	return sum;
+}
+
+/**
+ * Get the name of a kind.
+ * @param pKind The kind.
+ * @return The name (e.g. \tt{"organisms"}).
+ */
+const char* ObjectCounter::GetName(uint pKind) {
+	static const char* names[NUM_KINDS] = { "organisms", "genomes", "fitness" };
+	return pKind < NUM_KINDS ? names[pKind] : "unknown";
+}
+
+void ObjectCounter::Add(Kind pKind, llong pDelta) {
+	thread_local uint slot = sNextSlot.fetch_add(1, memory_order_relaxed) % NUM_SLOTS;
+	sSlots[slot].values[pKind].fetch_add(pDelta, memory_order_relaxed);
+}
+
+#ifndef DOXYGEN_IGNORE
+struct Collector {
+	ObjectCounter::Report& report;
+	unordered_set<const void*> organisms;
+	unordered_set<const void*> genomes;
+	unordered_set<const void*> fitness;
+	unordered_map<type_index, uint> genomeTypes;
+
+	void AddGenome(const GenomePtr& pGenome) {
+		if (!pGenome || !genomes.insert(pGenome.get()).second)
+			return;
+
+		type_index type = typeid(*pGenome);
+		auto entry = genomeTypes.find(type);
+		if (entry == genomeTypes.end()) {
+			entry = genomeTypes.emplace(type, report.genomes.size()).first;
+			report.genomes.push_back({ pGenome->GetTypeNameSafe(type.name()), 0, 0 });
+		}
+		auto& usage = report.genomes[entry->second];
+		usage.count++;
+		usage.bytes += pGenome->GetMemoryUsage();
+	}
+
+	void AddOrganism(const OrganismPtr& pOrganism) {
+		if (!pOrganism || !organisms.insert(pOrganism.get()).second)
+			return;
+
+		report.organisms.count++;
+		report.organisms.bytes += sizeof(Organism);
+		AddGenome(pOrganism->GetGenome());
+
+		FitnessPtr fit = pOrganism->GetFitness();
+		if (fit && fitness.insert(fit.get()).second) {
+			report.fitness.count++;
+			report.fitness.bytes += fit->GetMemoryUsage();
+		}
+	}
+
+	void AddPool(string pIndex, const PoolPtr& pPool) {
+		ObjectCounter::Usage usage { pIndex + ":" + pPool->GetTypeNameSafe("Pool"), 0, 0 };
+
+		if (auto pool = dynamic_pointer_cast<OrganismPool>(pPool)) {
+			usage.count = pool->size();
+			usage.bytes = sizeof(OrganismPool) + pool->capacity() * sizeof(OrganismPtr);
+			for (auto& organism : *pool)
+				AddOrganism(organism);
+		} else if (auto pool = dynamic_pointer_cast<GenomePool>(pPool)) {
+			usage.count = pool->size();
+			usage.bytes = sizeof(GenomePool) + pool->capacity() * sizeof(GenomePtr);
+			for (auto& genome : *pool)
+				AddGenome(genome);
+		} else if (auto pool = dynamic_pointer_cast<MetaPool>(pPool)) {
+			usage.count = pool->size();
+			usage.bytes = sizeof(MetaPool);
+			for (auto& entry : *pool)
+				if (entry.second)
+					AddPool(pIndex + "." + to_string(entry.first), entry.second);
+		}
+		report.pools.push_back(usage);
+	}
+};
+#endif
+
+/**
+ * Collect the memory accounting of a Population.
+ * This function must be called by the thread running the evolution (e.g. in Hook::DoGenerational()),
+ * because it walks the pools.
+ * @param pPopulation The Population.
+ * @return The report of the current generation.
+ */
+ObjectCounter::Report ObjectCounter::Collect(const Population& pPopulation) {
+	Report report { };
+	report.generation = pPopulation.GetGeneration();
+	for (uint i = 0; i < NUM_KINDS; i++)
+		report.live[i] = GetLive(Kind(i));
+
+	Collector collector { report, { }, { }, { }, { } };
+	for (auto& entry : pPopulation.GetPools())
+		if (entry.second)
+			collector.AddPool(to_string(entry.first), entry.second);
+
+	report.totalBytes = report.organisms.bytes + report.fitness.bytes;
+	for (auto& usage : report.genomes)
+		report.totalBytes += usage.bytes;
+	for (auto& usage : report.pools)
+		report.totalBytes += usage.bytes;
+	return report;
+}
+
+static string Bytes(ullong pBytes) {
+	ostringstream oss;
+	oss << fixed << setprecision(1);
+	if (pBytes >= (1ull << 30))
+		oss << pBytes / double(1ull << 30) << " GiB";
+	else if (pBytes >= (1ull << 20))
+		oss << pBytes / double(1ull << 20) << " MiB";
+	else
+		oss << pBytes / 1024.0 << " KiB";
+	return oss.str();
+}
+
+/**
+ * Write a report in a human-readable line.
+ * @param pStream The output stream.
+ * @param pReport The report.
+ */
+void ObjectCounter::Write(ostream& pStream, const Report& pReport) {
+	pStream << "Memory (generation " << pReport.generation << "): " << Bytes(pReport.totalBytes) << " reachable | live";
+	for (uint i = 0; i < NUM_KINDS; i++)
+		pStream << " " << GetName(i) << " " << pReport.live[i];
+	pStream << " | organisms " << pReport.organisms.count << " (" << Bytes(pReport.organisms.bytes) << "), fitness "
+			<< pReport.fitness.count << " (" << Bytes(pReport.fitness.bytes) << ")";
+	for (auto& usage : pReport.genomes)
+		pStream << ", " << usage.type << " " << usage.count << " (" << Bytes(usage.bytes) << ")";
+	pStream << " | pools";
+	for (auto& usage : pReport.pools)
+		pStream << " [" << usage.type << "] " << usage.count << " (" << Bytes(usage.bytes) << ")";
+}
+
+} /* namespace ea */
@@ -0,0 +1,87 @@
+/*
+ * ObjectCounter.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../Common.h"
+#include <atomic>
+
+namespace ea {
+
+using namespace std;
+
+class Population;
+
+class ObjectCounter {
+public:
+	enum Kind {
+		ORGANISM,	///< Organism instances.
+		GENOME,		///< Genome instances (of all types).
+		FITNESS,	///< Fitness instances (of all types).
+		NUM_KINDS
+	};
+
+	/**
+	 * The number and the footprint of the objects of one type.
+	 */
+	struct Usage {
+		string type;	///< The type name (or the pool index for pools).
+		ullong count;	///< The number of objects (entries for pools).
+		ullong bytes;	///< The footprint in bytes (excluding the allocator overhead).
+	};
+
+	/**
+	 * The memory accounting of a Population at one generation.
+	 */
+	struct Report {
+		ullong generation;				///< The generation of the report.
+		llong live[NUM_KINDS];			///< The live instances of each Kind in the whole process.
+		Usage organisms;				///< The organisms reachable from the pools.
+		Usage fitness;					///< The Fitness objects reachable from the pools.
+		vector<Usage> genomes;			///< The genomes reachable from the pools, by type.
+		vector<Usage> pools;			///< The pools of the Population (type is "<index>:<pool type>").
+		ullong totalBytes;				///< The footprint of everything reachable from the pools.
+	};
+
+	static void SetEnabled(bool pEnabled);
+	static llong GetLive(Kind pKind);
+	static Report Collect(const Population& pPopulation);
+	static void Write(ostream& pStream, const Report& pReport);
+	static const char* GetName(uint pKind);
+
+	/**
+	 * Whether the live instances are being counted.
+	 * @return true if SetEnabled(true) has been called.
+	 */
+	static inline bool IsEnabled() {
+		return sEnabled.load(memory_order_relaxed);
+	}
+
+	/**
+	 * Count a new instance. Called by the constructors of the counted classes.
+	 * @param pKind The kind of the instance.
+	 */
+	static inline void Created(Kind pKind) {
+		if (IsEnabled())
+			Add(pKind, 1);
+	}
+
+	/**
+	 * Count a destroyed instance. Called by the destructors of the counted classes.
+	 * @param pKind The kind of the instance.
+	 */
+	static inline void Destroyed(Kind pKind) {
+		if (IsEnabled())
+			Add(pKind, -1);
+	}
+
+private:
+	static atomic<bool> sEnabled;
+	static void Add(Kind pKind, llong pDelta);
+};
+
+} /* namespace ea */
@@ -0,0 +1,174 @@
+/*
+ * PerfCounters.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../pch.h"
+#include "PerfCounters.h"
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace ea {
+
+/**
+ * @class PerfCounters
+ * Static class reading hardware performance counters of the calling thread.
+ * When enabled, every phase measured by Session (see Strategy::Execute()) also records the number of CPU cycles,
+ * instructions, cache misses and branch misses spent by the thread executing it.
+ * The counters are reported next to the time records (see Session::TimeRecord) and attached to the
+ * phase events written by Tracer.
+ *
+ * The counters are read through \tt{perf_event_open} on Linux. Each thread opens its own counter group
+ * on its first read. Events which are not supported by the machine are left out (see Values::valid), and
+ * if no event can be opened (e.g. \tt{/proc/sys/kernel/perf_event_paranoid} disallows it, or on other systems),
+ * Read() returns false and phases are only timed.
+ *
+ * Only the thread executing a phase is counted. Work done by other threads of the same phase
+ * (e.g. in MultiThreading::For()) is not included.
+ *
+ * @code
+ * PerfCounters::SetEnabled(true);
+ * strategy->Evolve();
+ * @endcode
+ *
+ * @see Session
+ */
+
+#ifndef DOXYGEN_IGNORE
+#ifdef __linux__
+static const ullong sConfigs[PerfCounters::NUM_EVENTS] = {
+	PERF_COUNT_HW_CPU_CYCLES,
+	PERF_COUNT_HW_INSTRUCTIONS,
+	PERF_COUNT_HW_CACHE_MISSES,
+	PERF_COUNT_HW_BRANCH_MISSES
+};
+
+struct CounterGroup {
+	int leader;
+	int fds[PerfCounters::NUM_EVENTS];
+	uint valid;
+	uint size;
+
+	CounterGroup() : leader(-1), fds(), valid(0), size(0) {
+		for (auto& fd : fds)
+			fd = -1;
+
+		for (uint i = 0; i < PerfCounters::NUM_EVENTS; i++) {
+			perf_event_attr attr;
+			memset(&attr, 0, sizeof(attr));
+			attr.size = sizeof(attr);
+			attr.type = PERF_TYPE_HARDWARE;
+			attr.config = sConfigs[i];
+			attr.disabled = leader == -1;
+			attr.exclude_kernel = 1;
+			attr.exclude_hv = 1;
+			attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+			fds[i] = syscall(__NR_perf_event_open, &attr, 0, -1, leader, 0);
+			if (fds[i] == -1)
+				continue;
+
+			if (leader == -1)
+				leader = fds[i];
+			valid |= 1 << i;
+			size++;
+		}
+
+		if (leader == -1) {
+			static atomic<bool> reported(false);
+			if (!reported.exchange(true))
+				EA_LOG_DEBUG << "PerfCounters: Hardware counters are not available (" << strerror(errno)
+						<< "), phases are only timed." << flush;
+			return;
+		}
+
+		ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+		ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	}
+
+	~CounterGroup() {
+		for (int fd : fds)
+			if (fd != -1)
+				close(fd);
+	}
+
+	bool Read(PerfCounters::Values& pValues) {
+		if (leader == -1)
+			return false;
+
+		// nr, time enabled, time running, values
+		ullong buffer[3 + PerfCounters::NUM_EVENTS];
+		if (read(leader, buffer, sizeof(buffer)) < ssize_t((3 + size) * sizeof(ullong)))
+			return false;
+
+		// Scale up if the counters were multiplexed with other events
+		double scale = buffer[2] && buffer[2] < buffer[1] ? double(buffer[1]) / buffer[2] : 1.0;
+
+		uint index = 3;
+		for (uint i = 0; i < PerfCounters::NUM_EVENTS; i++)
+			pValues.values[i] = valid & (1 << i) ? ullong(buffer[index++] * scale) : 0;
+		pValues.valid = valid;
+		return true;
+	}
+};
+#endif
+#endif
+
+atomic<bool> PerfCounters::sEnabled(false);
+
+/**
+ * Enable or disable reading the counters in measured phases.
+ * @param pEnabled true to record counters of every measured phase.
+ */
+void PerfCounters::SetEnabled(bool pEnabled) {
+	sEnabled = pEnabled;
+}
+
+/**
+ * Check whether any counter can be read by the calling thread.
+ * @return false if the system does not allow reading hardware counters.
+ */
+bool PerfCounters::IsAvailable() {
+	Values values;
+	return Read(values);
+}
+
+/**
+ * Read the current counter values of the calling thread.
+ * The values only grow, so the counts of a code section are the differences of two reads.
+ * @param pValues Receives the counter values.
+ * @return false if no counter is available (pValues is not modified).
+ */
+bool PerfCounters::Read(Values& pValues) {
+#ifdef __linux__
+	static thread_local CounterGroup tGroup;
+	return tGroup.Read(pValues);
+#else
+	return false;
+#endif
+}
+
+/**
+ * Get the name of an event (used in reports).
+ * @param pEvent The Event.
+ * @return The short name of the event.
+ */
+const char* PerfCounters::GetName(uint pEvent) {
+	static const char* names[NUM_EVENTS] = { "cycles", "instructions", "cache-misses", "branch-misses" };
+	return pEvent < NUM_EVENTS ? names[pEvent] : "";
+}
+
+/**
+ * @struct PerfCounters::Values
+ * A snapshot of the counters of a thread.
+ */
+
+} /* namespace ea */
@@ -0,0 +1,49 @@
+/*
+ * PerfCounters.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../Common.h"
+#include <atomic>
+
+namespace ea {
+
+using namespace std;
+
+class PerfCounters {
+public:
+	enum Event {
+		CYCLES,			///< CPU cycles.
+		INSTRUCTIONS,	///< Retired instructions.
+		CACHE_MISSES,	///< Last level cache misses.
+		BRANCH_MISSES,	///< Mispredicted branches.
+		NUM_EVENTS
+	};
+
+	struct Values {
+		ullong values[NUM_EVENTS];	///< The counter values.
+		uint valid;					///< Bit mask of the events which are counted (bit i is Event i).
+	};
+
+	static void SetEnabled(bool pEnabled);
+	static bool IsAvailable();
+	static bool Read(Values& pValues);
+	static const char* GetName(uint pEvent);
+
+	/**
+	 * Whether the counters are read by measured phases.
+	 * @return true if SetEnabled(true) has been called.
+	 */
+	static inline bool IsEnabled() {
+		return sEnabled.load(memory_order_relaxed);
+	}
+
+private:
+	static atomic<bool> sEnabled;
+};
+
+} /* namespace ea */
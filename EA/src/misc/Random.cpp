@@ -45,6 +45,72 @@ void Random::SeedByNow() {
 	generator = default_random_engine(std::chrono::system_clock::now().time_since_epoch().count());
 }
 
+/**
+ * Write the state of Random::generator and of the internal distributions to a stream.
+ * The state is written in text form, as defined by the standard library.
+ * @param pStream The output stream.
+ */
+void Random::SaveState(ostream& pStream) {
+	pStream << generator << ' ' << sRate << ' ' << sNormal;
+}
+
+/**
+ * Read the state written by SaveState() from a stream.
+ * After this call, Random produces the same sequence as it did after SaveState().
+ * @param pStream The input stream.
+ */
+void Random::LoadState(istream& pStream) {
+	pStream >> generator >> sRate >> sNormal;
+}
+
+// The probability of Bits(double) in fixed point, between 0 and 2^32
+static ullong FixedRate(double pRate) {
+	return llround(min(max(pRate, 0.0), 1.0) * 4294967296.0);
+}
+
+/**
+ * Generate 64 random bits, each of them is set with the given probability.
+ * The bits are drawn together: the result is a chain of AND and OR of random words
+ * following the binary expansion of the probability (from the least significant bit),
+ * so a probability with \f$k\f$ significant bits costs \f$k\f$ calls to Bits()
+ * (e.g. one call for 0.5 and two calls for 0.25 or 0.75, but 32 calls for 0.3), see BitsCost().
+ * @param pRate The probability of each bit (rounded to a multiple of \f$2^{-32}\f$).
+ * @return The random bits.
+ */
+ullong Random::Bits(double pRate) {
+	ullong fixed = FixedRate(pRate);
+	if (fixed == 0)
+		return 0;
+	if (fixed >> 32)
+		return ~0ull;
+
+	// The trailing zeros of the expansion would only AND random words into 0
+	ullong bits = 0;
+	for (int i = __builtin_ctzll(fixed); i < 32; i++)
+		bits = ((fixed >> i) & 1) ? (bits | Bits()) : (bits & Bits());
+	return bits;
+}
+
+/**
+ * Get the number of calls to Bits() made by Bits(double) for a probability.
+ * @param pRate The probability of each bit.
+ * @return The number of significant bits of the probability (0 for 0 and 1, at most 32).
+ */
+uint Random::BitsCost(double pRate) {
+	ullong fixed = FixedRate(pRate);
+	if (fixed == 0 || (fixed >> 32))
+		return 0;
+	return 32 - __builtin_ctzll(fixed);
+}
+
+/**
+ * @fn ullong Random::Bits()
+ * Generate 64 uniformly random bits.
+ * This function will use the static Random::generator to generate the value.
+ * Like Bool(), it uses the raw output of the generator (31 bits per call) without any distribution.
+ * @return A random 64-bit word.
+ */
+
 /**
  * @fn double Random::Rate()
  * Generate a random rate between 0.0 and 1.0 inclusively.
@@ -24,6 +24,12 @@ public:
 	static void Seed(llong seed);
 	static void SeedByNow();
 
+	static void SaveState(ostream& pStream);
+	static void LoadState(istream& pStream);
+
+	static ullong Bits(double pRate);
+	static uint BitsCost(double pRate);
+
 	static inline double Rate() {
 		return sRate(generator);
 	}
@@ -56,6 +62,12 @@ public:
 	static inline bool Bool() {
 		return generator() & 1;
 	}
+
+	static inline ullong Bits() {
+		ullong bits = generator();
+		bits |= ullong(generator()) << 31;
+		return bits | ullong(generator()) << 62;
+	}
 };
 
 } /* namespace ea */
@@ -0,0 +1,110 @@
+/*
+ * RecordStore.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../Common.h"
+#include <atomic>
+
+namespace ea {
+
+using namespace std;
+
+/**
+ * Append-only list of records with a single writer and lock-free concurrent readers.
+ * Records are stored in segments of growing size (each segment is twice as large as the previous one),
+ * which are never moved or freed while the store is in use. Therefore a reader holding an index below
+ * GetSize() can always access the record, even while the writer is appending
+ * (unlike @tt{std::vector}, where a reallocation invalidates concurrent readers).
+ *
+ * Append() must only be called by one thread at a time. GetSize() and operator[]() can be called
+ * by any number of threads without locking. Clear() must not be called while other threads are reading.
+ *
+ * @tparam T The record type (must be default constructible and copy assignable).
+ */
+template <class T>
+class RecordStore {
+public:
+	/**
+	 * Create an empty store.
+	 */
+	RecordStore() : mSize(0) {
+		for (auto& segment : mSegments)
+			segment.store(nullptr, memory_order_relaxed);
+	}
+	~RecordStore() {
+		Clear();
+	}
+
+	RecordStore(const RecordStore&) = delete;
+	RecordStore& operator=(const RecordStore&) = delete;
+
+	/**
+	 * Append a record (only called by the writer thread).
+	 * The record is visible to readers once this function returns.
+	 * @param pRecord The record to be appended.
+	 */
+	void Append(const T& pRecord) {
+		ullong index = mSize.load(memory_order_relaxed);
+		uint segment = GetSegment(index);
+		if (segment >= MAX_SEGMENTS)
+			throw EA_EXCEPTION(EAException, OTHERS, "RecordStore::Append(): The store is full.");
+
+		T* records = mSegments[segment].load(memory_order_relaxed);
+		if (!records) {
+			records = new T[BASE_SIZE << segment];
+			mSegments[segment].store(records, memory_order_relaxed);
+		}
+
+		records[index - GetSegmentStart(segment)] = pRecord;
+		mSize.store(index + 1, memory_order_release);
+	}
+
+	/**
+	 * Get the number of records appended so far.
+	 * @return The number of readable records.
+	 */
+	ullong GetSize() const {
+		return mSize.load(memory_order_acquire);
+	}
+
+	/**
+	 * Access a record.
+	 * @param pIndex The index of the record (must be less than a value returned by GetSize()).
+	 * @return The record.
+	 */
+	const T& operator[](ullong pIndex) const {
+		uint segment = GetSegment(pIndex);
+		return mSegments[segment].load(memory_order_relaxed)[pIndex - GetSegmentStart(segment)];
+	}
+
+	/**
+	 * Remove all records and free the memory.
+	 * Must not be called while other threads are reading.
+	 */
+	void Clear() {
+		mSize.store(0, memory_order_relaxed);
+		for (auto& segment : mSegments)
+			delete[] segment.exchange(nullptr, memory_order_relaxed);
+	}
+
+private:
+	static const ullong BASE_SIZE = 64;
+	static const uint MAX_SEGMENTS = 40;
+
+	atomic<T*> mSegments[MAX_SEGMENTS];
+	atomic<ullong> mSize;
+
+	static uint GetSegment(ullong pIndex) {
+		return 63 - __builtin_clzll(pIndex / BASE_SIZE + 1);
+	}
+	static ullong GetSegmentStart(uint pSegment) {
+		return BASE_SIZE * ((1ull << pSegment) - 1);
+	}
+};
+
+} /* namespace ea */
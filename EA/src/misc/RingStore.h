@@ -0,0 +1,155 @@
+/*
+ * RingStore.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../Common.h"
+#include <atomic>
+#include <type_traits>
+
+namespace ea {
+
+using namespace std;
+
+/**
+ * List of the latest records with a single writer and lock-free concurrent readers.
+ * The store has a fixed capacity: when it is full, a new record overwrites the oldest one,
+ * so the memory usage never exceeds the capacity. Records keep increasing indices,
+ * GetBegin() and GetSize() give the range of the records still kept.
+ * The slots are allocated in segments of growing size (each segment is twice as large as the previous one)
+ * when first needed, so a store that only receives a few records stays small.
+ *
+ * A reader copies a record then checks that it has not been overwritten meanwhile (like a seqlock),
+ * so Get() never returns a partially overwritten record.
+ *
+ * Append() must only be called by one thread at a time. GetSize(), GetBegin() and Get() can be called
+ * by any number of threads without locking. Clear() must not be called while other threads are reading.
+ *
+ * @tparam T The record type (must be trivially copyable).
+ *
+ * @see RecordStore
+ */
+template <class T>
+class RingStore {
+	static_assert(is_trivially_copyable<T>::value, "RingStore<T>: T must be trivially copyable.");
+
+public:
+	/**
+	 * Create an empty store.
+	 * @param pCapacity The maximum number of records kept (at least 1).
+	 */
+	RingStore(ullong pCapacity) : mCapacity(max<ullong>(pCapacity, 1)), mBegin(0), mSize(0) {
+		for (auto& segment : mSegments)
+			segment.store(nullptr, memory_order_relaxed);
+	}
+	~RingStore() {
+		Clear();
+	}
+
+	RingStore(const RingStore&) = delete;
+	RingStore& operator=(const RingStore&) = delete;
+
+	/**
+	 * Append a record (only called by the writer thread).
+	 * The record is visible to readers once this function returns.
+	 * If the store is full, the oldest record is removed.
+	 * @param pRecord The record to be appended.
+	 */
+	void Append(const T& pRecord) {
+		ullong index = mSize.load(memory_order_relaxed);
+		ullong slot = index % mCapacity;
+
+		// Readers must stop accepting the oldest record before it is overwritten
+		// (a reader seeing the new begin also sees everything the writer did before)
+		if (index >= mCapacity) {
+			mBegin.store(index + 1 - mCapacity, memory_order_release);
+			atomic_thread_fence(memory_order_release);
+		}
+
+		uint segment = GetSegment(slot);
+		T* records = mSegments[segment].load(memory_order_relaxed);
+		if (!records) {
+			records = new T[min(BASE_SIZE << segment, mCapacity - GetSegmentStart(segment))];
+			mSegments[segment].store(records, memory_order_relaxed);
+		}
+
+		records[slot - GetSegmentStart(segment)] = pRecord;
+		mSize.store(index + 1, memory_order_release);
+	}
+
+	/**
+	 * Get the number of records appended so far (including the removed ones).
+	 * @return The index following the last record.
+	 */
+	ullong GetSize() const {
+		return mSize.load(memory_order_acquire);
+	}
+
+	/**
+	 * Get the index of the oldest record still kept.
+	 * @return The index of the oldest record.
+	 */
+	ullong GetBegin() const {
+		return mBegin.load(memory_order_acquire);
+	}
+
+	/**
+	 * Get the maximum number of records kept.
+	 * @return The capacity.
+	 */
+	ullong GetCapacity() const {
+		return mCapacity;
+	}
+
+	/**
+	 * Copy a record.
+	 * @param pIndex The index of the record.
+	 * @param pRecord Receives the record.
+	 * @return false if the record has not been appended yet or has been removed.
+	 */
+	bool Get(ullong pIndex, T& pRecord) const {
+		if (pIndex >= mSize.load(memory_order_acquire))
+			return false;
+
+		ullong slot = pIndex % mCapacity;
+		uint segment = GetSegment(slot);
+		pRecord = mSegments[segment].load(memory_order_relaxed)[slot - GetSegmentStart(segment)];
+
+		// The copy is only valid if the writer did not start overwriting the record meanwhile
+		atomic_thread_fence(memory_order_acquire);
+		return pIndex >= mBegin.load(memory_order_relaxed);
+	}
+
+	/**
+	 * Remove all records and free the memory.
+	 * Must not be called while other threads are reading.
+	 */
+	void Clear() {
+		mBegin.store(0, memory_order_relaxed);
+		mSize.store(0, memory_order_relaxed);
+		for (auto& segment : mSegments)
+			delete[] segment.exchange(nullptr, memory_order_relaxed);
+	}
+
+private:
+	static const ullong BASE_SIZE = 64;
+	static const uint MAX_SEGMENTS = 40;
+
+	const ullong mCapacity;
+	atomic<T*> mSegments[MAX_SEGMENTS];
+	atomic<ullong> mBegin;
+	atomic<ullong> mSize;
+
+	static uint GetSegment(ullong pSlot) {
+		return 63 - __builtin_clzll(pSlot / BASE_SIZE + 1);
+	}
+	static ullong GetSegmentStart(uint pSegment) {
+		return BASE_SIZE * ((1ull << pSegment) - 1);
+	}
+};
+
+} /* namespace ea */
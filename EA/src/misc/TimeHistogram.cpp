@@ -0,0 +1,157 @@
+/*
+ * TimeHistogram.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../pch.h"
+#include "TimeHistogram.h"
+
+namespace ea {
+
+/**
+ * @class TimeHistogram
+ * Log-bucketed histogram of durations.
+ * Durations are recorded in nanoseconds into buckets whose width grows with the duration
+ * (see GetBucket()), so a histogram has a fixed size and recording is a few relaxed atomic stores.
+ * Percentiles are estimated from the buckets with a relative error below 6.25%.
+ *
+ * A histogram has a single writer: Session keeps one histogram per phase and per thread,
+ * and merges them with Merge() when the records are queried. Readers may query a histogram
+ * while it is being written.
+ *
+ * All getters return milliseconds.
+ *
+ * @see Session
+ */
+
+/**
+ * @var TimeHistogram::SUB_BUCKETS
+ * The number of buckets per power of two.
+ */
+
+/**
+ * @var TimeHistogram::BUCKET_COUNT
+ * The total number of buckets.
+ */
+
+#ifndef DOXYGEN_IGNORE
+static const float NANOS_TO_MILLIS = 1e-6f;
+
+static ullong GetLowerBound(uint pBucket) {
+	if (pBucket < TimeHistogram::SUB_BUCKETS)
+		return pBucket;
+	uint exponent = pBucket / TimeHistogram::SUB_BUCKETS + 2;
+	uint sub = pBucket % TimeHistogram::SUB_BUCKETS;
+	return ullong(TimeHistogram::SUB_BUCKETS + sub) << (exponent - 3);
+}
+#endif
+
+/**
+ * Create an empty histogram.
+ */
+TimeHistogram::TimeHistogram() : mCount(0), mTotal(0), mMax(0) {
+	for (auto& bucket : mBuckets)
+		bucket.store(0, memory_order_relaxed);
+}
+
+/**
+ * Copy a histogram.
+ * @param pOther The histogram to be copied.
+ */
+TimeHistogram::TimeHistogram(const TimeHistogram& pOther) : TimeHistogram() {
+	Merge(pOther);
+}
+
+/**
+ * Copy a histogram.
+ * @param pOther The histogram to be copied.
+ * @return This histogram.
+ */
+TimeHistogram& TimeHistogram::operator=(const TimeHistogram& pOther) {
+	if (this != &pOther) {
+		for (uint i = 0; i < BUCKET_COUNT; i++)
+			mBuckets[i].store(pOther.mBuckets[i].load(memory_order_relaxed), memory_order_relaxed);
+		mCount.store(pOther.mCount.load(memory_order_relaxed), memory_order_relaxed);
+		mTotal.store(pOther.mTotal.load(memory_order_relaxed), memory_order_relaxed);
+		mMax.store(pOther.mMax.load(memory_order_relaxed), memory_order_relaxed);
+	}
+	return *this;
+}
+
+/**
+ * Add the records of another histogram to this one.
+ * @param pOther The histogram to be merged.
+ */
+void TimeHistogram::Merge(const TimeHistogram& pOther) {
+	for (uint i = 0; i < BUCKET_COUNT; i++)
+		mBuckets[i].fetch_add(pOther.mBuckets[i].load(memory_order_relaxed), memory_order_relaxed);
+	mCount.fetch_add(pOther.mCount.load(memory_order_relaxed), memory_order_relaxed);
+	mTotal.fetch_add(pOther.mTotal.load(memory_order_relaxed), memory_order_relaxed);
+	ullong max = pOther.mMax.load(memory_order_relaxed);
+	if (max > mMax.load(memory_order_relaxed))
+		mMax.store(max, memory_order_relaxed);
+}
+
+/**
+ * Get the number of recorded durations.
+ * @return The number of records.
+ */
+ullong TimeHistogram::GetCount() const {
+	return mCount.load(memory_order_relaxed);
+}
+
+/**
+ * Get the sum of recorded durations.
+ * @return The total duration (ms).
+ */
+float TimeHistogram::GetTotal() const {
+	return mTotal.load(memory_order_relaxed) * NANOS_TO_MILLIS;
+}
+
+/**
+ * Get the average of recorded durations.
+ * @return The average duration (ms), or 0 if nothing was recorded.
+ */
+float TimeHistogram::GetAverage() const {
+	ullong count = GetCount();
+	return count ? GetTotal() / count : 0;
+}
+
+/**
+ * Get the longest recorded duration.
+ * @return The maximum duration (ms).
+ */
+float TimeHistogram::GetMax() const {
+	return mMax.load(memory_order_relaxed) * NANOS_TO_MILLIS;
+}
+
+/**
+ * Estimate a percentile of the recorded durations.
+ * The estimate is the middle of the bucket containing the percentile, capped by the maximum.
+ * @param pPercentile The percentile, from 0 to 100 (e.g. 99 for p99).
+ * @return The estimated duration (ms), or 0 if nothing was recorded.
+ */
+float TimeHistogram::GetPercentile(double pPercentile) const {
+	ullong count = 0;
+	ullong buckets[BUCKET_COUNT];
+	for (uint i = 0; i < BUCKET_COUNT; i++)
+		count += buckets[i] = mBuckets[i].load(memory_order_relaxed);
+	if (count == 0)
+		return 0;
+
+	ullong rank = max<ullong>(1, ceil(pPercentile / 100 * count));
+	ullong max = mMax.load(memory_order_relaxed);
+	for (uint i = 0; i < BUCKET_COUNT; i++) {
+		if (buckets[i] >= rank) {
+			ullong lower = GetLowerBound(i);
+			ullong upper = i + 1 < BUCKET_COUNT ? GetLowerBound(i + 1) : max + 1;
+			return min<ullong>((lower + upper - 1) / 2, max) * NANOS_TO_MILLIS;
+		}
+		rank -= buckets[i];
+	}
+	return max * NANOS_TO_MILLIS;
+}
+
+} /* namespace ea */
@@ -0,0 +1,70 @@
+/*
+ * TimeHistogram.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../Common.h"
+#include <atomic>
+
+namespace ea {
+
+using namespace std;
+
+class TimeHistogram {
+public:
+	static const uint SUB_BUCKETS = 8;
+	static const uint BUCKET_COUNT = 62 * SUB_BUCKETS;
+
+	TimeHistogram();
+	TimeHistogram(const TimeHistogram& pOther);
+	TimeHistogram& operator=(const TimeHistogram& pOther);
+
+	/**
+	 * Record a duration.
+	 * Only one thread may call this function at a time (other threads may read concurrently).
+	 * @param pNanos The duration in nanoseconds.
+	 */
+	inline void Add(ullong pNanos) {
+		atomic<ullong>& bucket = mBuckets[GetBucket(pNanos)];
+		bucket.store(bucket.load(memory_order_relaxed) + 1, memory_order_relaxed);
+		mCount.store(mCount.load(memory_order_relaxed) + 1, memory_order_relaxed);
+		mTotal.store(mTotal.load(memory_order_relaxed) + pNanos, memory_order_relaxed);
+		if (pNanos > mMax.load(memory_order_relaxed))
+			mMax.store(pNanos, memory_order_relaxed);
+	}
+
+	void Merge(const TimeHistogram& pOther);
+
+	ullong GetCount() const;
+	float GetTotal() const;
+	float GetAverage() const;
+	float GetMax() const;
+	float GetPercentile(double pPercentile) const;
+
+	/**
+	 * Get the bucket of a duration.
+	 * Durations below SUB_BUCKETS ns have their own bucket. Above, each power of two is split into
+	 * SUB_BUCKETS buckets, so the relative error of a percentile is below 1 / (2 * SUB_BUCKETS).
+	 * @param pNanos The duration in nanoseconds.
+	 * @return The bucket index.
+	 */
+	static inline uint GetBucket(ullong pNanos) {
+		if (pNanos < SUB_BUCKETS)
+			return pNanos;
+		uint exponent = 63 - __builtin_clzll(pNanos);
+		uint sub = (pNanos >> (exponent - 3)) & (SUB_BUCKETS - 1);
+		return min<uint>((exponent - 2) * SUB_BUCKETS + sub, BUCKET_COUNT - 1);
+	}
+
+private:
+	atomic<ullong> mBuckets[BUCKET_COUNT];
+	atomic<ullong> mCount;
+	atomic<ullong> mTotal;
+	atomic<ullong> mMax;
+};
+
+} /* namespace ea */
@@ -0,0 +1,172 @@
+/*
+ * Tracer.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../pch.h"
+#include "Tracer.h"
+#include "Json.h"
+#include <fstream>
+#include <mutex>
+#include <unistd.h>
+
+namespace ea {
+
+/**
+ * @class Tracer
+ * Static class which records a timeline of the evolution process.
+ * When enabled, the library records an event (with its thread and its begin and end time) for:
+ * - every phase executed by Strategy::Execute() (category \tt{"phase"}) and every generation (\tt{"strategy"}),
+ * - every call of a Hook (\tt{"hook"}),
+ * - every individual evaluation of IndividualEvaluator (\tt{"evaluation"}),
+ * - the share of each thread in MultiThreading::For() (\tt{"parallel"}),
+ * - every message sent or received by the cluster master and slaves (\tt{"cluster"}).
+ *
+ * If PerfCounters is enabled, phase events carry the hardware counters of the phase as arguments.
+ *
+ * The timeline is written in the Chrome trace event format (JSON), which can be opened in
+ * Perfetto (https://ui.perfetto.dev) or chrome://tracing, to find serial sections and load imbalance.
+ *
+ * @code
+ * Tracer::Start();
+ * strategy->Evolve();
+ * Tracer::Stop();
+ * Tracer::Write("trace.json");
+ * @endcode
+ *
+ * TraceHook does the same from an EAML file.
+ * Each thread records into its own buffer, so recording only contends with Write() and Clear().
+ * When the Tracer is disabled, an instrumented call only costs a relaxed atomic load.
+ *
+ * @see TraceHook
+ */
+
+#ifndef DOXYGEN_IGNORE
+struct TraceEvent {
+	string name;
+	const char* category;
+	ullong start;
+	ullong duration;
+	vector<pair<const char*, double>> args;
+};
+
+struct TraceBuffer {
+	uint tid;
+	mutex lock;
+	vector<TraceEvent> events;
+};
+
+static mutex sMutex;
+static vector<shared_ptr<TraceBuffer>> sBuffers;
+static chrono::steady_clock::time_point sOrigin = chrono::steady_clock::now();
+
+static TraceBuffer& GetBuffer() {
+	static thread_local shared_ptr<TraceBuffer> tBuffer;
+	if (!tBuffer) {
+		lock_guard<mutex> lock(sMutex);
+		tBuffer = make_shared<TraceBuffer>();
+		tBuffer->tid = sBuffers.size() + 1;
+		sBuffers.push_back(tBuffer);
+	}
+	return *tBuffer;
+}
+
+static void WriteMicros(ostream& pStream, ullong pNanos) {
+	pStream << pNanos / 1000 << '.' << setw(3) << setfill('0') << pNanos % 1000 << setfill(' ');
+}
+#endif
+
+atomic<bool> Tracer::sEnabled(false);
+
+/**
+ * Start recording events.
+ * Events recorded before (and not cleared) are kept.
+ */
+void Tracer::Start() {
+	sEnabled = true;
+}
+
+/**
+ * Stop recording events.
+ * Recorded events are kept until Clear() is called.
+ */
+void Tracer::Stop() {
+	sEnabled = false;
+}
+
+/**
+ * Discard all recorded events.
+ */
+void Tracer::Clear() {
+	lock_guard<mutex> lock(sMutex);
+	for (auto& buffer : sBuffers) {
+		lock_guard<mutex> bufferLock(buffer->lock);
+		buffer->events.clear();
+	}
+}
+
+/**
+ * Write the recorded events in the Chrome trace event format.
+ * @param pStream The output stream.
+ */
+void Tracer::Write(ostream& pStream) {
+	lock_guard<mutex> lock(sMutex);
+	int pid = getpid();
+
+	pStream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+	bool first = true;
+	for (auto& buffer : sBuffers) {
+		lock_guard<mutex> bufferLock(buffer->lock);
+		if (buffer->events.empty())
+			continue;
+
+		pStream << (first ? "" : ",") << "\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":" << pid
+				<< ",\"tid\":" << buffer->tid << ",\"args\":{\"name\":\"Thread #" << buffer->tid << "\"}}";
+		first = false;
+
+		for (auto& event : buffer->events) {
+			pStream << ",\n{\"ph\":\"X\",\"name\":";
+			Json::WriteString(pStream, event.name);
+			pStream << ",\"cat\":\"" << event.category << "\",\"pid\":" << pid << ",\"tid\":" << buffer->tid << ",\"ts\":";
+			WriteMicros(pStream, event.start);
+			pStream << ",\"dur\":";
+			WriteMicros(pStream, event.duration);
+			if (!event.args.empty()) {
+				pStream << ",\"args\":{";
+				for (uint i = 0; i < event.args.size(); i++)
+					pStream << (i ? "," : "") << '"' << event.args[i].first << "\":" << event.args[i].second;
+				pStream << "}";
+			}
+			pStream << "}";
+		}
+	}
+	pStream << "\n]}\n";
+}
+
+/**
+ * Write the recorded events in the Chrome trace event format to a file.
+ * @param pFileName The path of the output file (overwritten if it exists).
+ */
+void Tracer::Write(string pFileName) {
+	ofstream file(pFileName);
+	if (!file)
+		throw EA_EXCEPTION(EAException, CANNOT_CREATE_FILE,
+				"Tracer::Write: Cannot create \"" + pFileName + "\".");
+	Write(file);
+	EA_LOG_DEBUG << "Tracer::Write: Trace saved to \"" << pFileName << "\"." << flush;
+}
+
+void Tracer::Record(string& pName, const char* pCategory,
+		chrono::steady_clock::time_point pStart, chrono::steady_clock::time_point pEnd,
+		vector<pair<const char*, double>>& pArgs) {
+	TraceBuffer& buffer = GetBuffer();
+	ullong start = chrono::duration_cast<chrono::nanoseconds>(pStart - sOrigin).count();
+	ullong duration = chrono::duration_cast<chrono::nanoseconds>(pEnd - pStart).count();
+
+	lock_guard<mutex> lock(buffer.lock);
+	buffer.events.push_back({ move(pName), pCategory, start, duration, move(pArgs) });
+}
+
+} /* namespace ea */
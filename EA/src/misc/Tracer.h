@@ -0,0 +1,101 @@
+/*
+ * Tracer.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../Common.h"
+#include <atomic>
+#include <chrono>
+#include <utility>
+
+namespace ea {
+
+using namespace std;
+
+class Tracer {
+public:
+	static void Start();
+	static void Stop();
+	static void Clear();
+	static void Write(ostream& pStream);
+	static void Write(string pFileName);
+
+	/**
+	 * Whether events are being recorded.
+	 * @return true if Start() has been called and Stop() has not.
+	 */
+	static inline bool IsEnabled() {
+		return sEnabled.load(memory_order_relaxed);
+	}
+
+	/**
+	 * RAII object recording one event from its construction to its destruction.
+	 * If the Tracer is disabled when the Scope is created, nothing is recorded.
+	 */
+	class Scope {
+	public:
+		/**
+		 * Begin an event.
+		 * @param pName The name of the event (only copied when the Tracer is enabled).
+		 * @param pCategory The category of the event (must be a string literal).
+		 */
+		inline Scope(const string& pName, const char* pCategory) : mCategory(nullptr), mName(), mStart(), mArgs() {
+			if (IsEnabled()) {
+				mCategory = pCategory;
+				mName = pName;
+				mStart = chrono::steady_clock::now();
+			}
+		}
+		/**
+		 * Begin an event.
+		 * @param pName The name of the event (must be a string literal).
+		 * @param pCategory The category of the event (must be a string literal).
+		 */
+		inline Scope(const char* pName, const char* pCategory) : mCategory(nullptr), mName(), mStart(), mArgs() {
+			if (IsEnabled()) {
+				mCategory = pCategory;
+				mName = pName;
+				mStart = chrono::steady_clock::now();
+			}
+		}
+		/**
+		 * End the event and record it.
+		 */
+		inline ~Scope() {
+			if (mCategory)
+				Record(mName, mCategory, mStart, chrono::steady_clock::now(), mArgs);
+		}
+		/**
+		 * Attach a numeric argument to the event (shown with the event in the trace viewer).
+		 * Nothing is stored if the event is not recorded.
+		 * @param pKey The name of the argument (must be a string literal).
+		 * @param pValue The value of the argument.
+		 */
+		inline void AddArg(const char* pKey, double pValue) {
+			if (mCategory)
+				mArgs.emplace_back(pKey, pValue);
+		}
+
+		Scope(const Scope&) = delete;
+		Scope& operator=(const Scope&) = delete;
+
+	private:
+		const char* mCategory;
+		string mName;
+		chrono::steady_clock::time_point mStart;
+		vector<pair<const char*, double>> mArgs;
+	};
+
+private:
+	static atomic<bool> sEnabled;
+
+	static void Record(string& pName, const char* pCategory,
+			chrono::steady_clock::time_point pStart, chrono::steady_clock::time_point pEnd,
+			vector<pair<const char*, double>>& pArgs);
+};
+
+} /* namespace ea */
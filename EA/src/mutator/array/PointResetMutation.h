@@ -12,6 +12,7 @@
 
 #include "../../EA/Type/Array.h"
 #include "../../genome/ArrayGenome.h"
+#include "../../misc/BitWords.h"
 #include "../TypedMutator.h"
 
 namespace ea {
@@ -33,10 +34,18 @@ using namespace std;
  * @tparam T Type of genes.
  *
  * @method
- * Iterate through the array of genes, then apply probability test.
+ * Instead of testing every gene, the positions to reset are sampled directly:
+ * the number of genes skipped before the next reset follows a geometric distribution,
+ * which gives exactly the same distribution as testing each gene with the given rate.
+ *
+ * For \ref FlipBitMutation (when duplicates are not allowed), a reset always flips the bit.
+ * Above a rate of 1/2, all the bits are flipped and the positions to flip back are sampled with the complementary rate.
+ * For the rates with few significant bits (e.g. 0.5 or 0.25), the bits are flipped a whole word at a time
+ * with random masks instead (see Random::Bits(double)).
  *
  * @time
- * O(N)
+ * O(N) to copy the genome, plus O(rN) random draws for a rate r
+ * (O(min(r, 1 - r) N) draws for \ref FlipBitMutation).
  *
  * @name{FlipBitMutation, IntPointResetMutation, DoublePointResetMutation}
  *
@@ -54,6 +63,11 @@ private:
 	RandomizerPtr<T> mRandomizer;
 	bool mAllowDuplicate;
 
+	template<class F>
+	void ForEachSampled(size_t pSize, double pRate, F pFunction);
+	void ResetGenes(vector<T>& pGenes);
+	void MutateGenes(vector<T>& pGenes);
+
 protected:
 	virtual ArrayGenomePtr<T> DoApply(const ArrayGenomePtr<T>& pTarget)
 			override;
@@ -121,6 +135,95 @@ EA_TYPEINFO_SPECIALIZED_INLINE(PointResetMutation, double){
 }
 #endif
 
+/**
+ * Call a function on each position sampled with a rate.
+ * @param pSize The number of genes.
+ * @param pRate The probability that each position is sampled.
+ * @param pFunction The function receiving the positions in increasing order.
+ */
+template<class T>
+template<class F>
+void PointResetMutation<T>::ForEachSampled(size_t pSize, double pRate, F pFunction) {
+	if (pRate >= 1) {
+		for (size_t i = 0; i < pSize; i++)
+			pFunction(i);
+		return;
+	}
+	if (!(pRate > 0))
+		return;
+
+	// The number of genes skipped before the next reset is floor(log(U) / log(1 - rate)),
+	// computed in double so that a skip beyond the end cannot overflow
+	double scale = 1 / log1p(-pRate);
+	for (double i = floor(log(1 - Random::Rate()) * scale); i < pSize; i += 1 + floor(log(1 - Random::Rate()) * scale))
+		pFunction(size_t(i));
+}
+
+/**
+ * Reset the sampled genes with the Randomizer.
+ * @param pGenes The genes to reset.
+ */
+template<class T>
+void PointResetMutation<T>::ResetGenes(vector<T>& pGenes) {
+	ForEachSampled(pGenes.size(), mRate, [this, &pGenes] (size_t i) {
+		if (mAllowDuplicate)
+			pGenes[i] = mRandomizer->Get();
+		else {
+			T oldGene = pGenes[i];
+			do
+				pGenes[i] = mRandomizer->Get();
+			while (pGenes[i] == oldGene);
+		}
+	});
+}
+
+template<class T>
+void PointResetMutation<T>::MutateGenes(vector<T>& pGenes) {
+	ResetGenes(pGenes);
+}
+
+#ifndef DOXYGEN_IGNORE
+template<>
+inline void PointResetMutation<bool>::MutateGenes(vector<bool>& pGenes) {
+	// A reset without duplicate of a bit is a flip, which needs no Randomizer
+	if (mAllowDuplicate) {
+		ResetGenes(pGenes);
+		return;
+	}
+
+	// Above 1/2, flip all the bits then flip back each of them with the complementary rate
+	double rate = mRate;
+	if (rate > 0.5) {
+#ifdef EA_BIT_WORDS
+		BitWords::Flip(pGenes);
+#else
+		pGenes.flip();
+#endif
+		rate = 1 - rate;
+	}
+	if (!(rate > 0) || pGenes.empty())
+		return;
+
+#ifdef EA_BIT_WORDS
+	// A mask costs Random::BitsCost() random words per word of genes (up to 32, 3 generator calls each),
+	// sampling costs 64 * rate positions per word of genes (2 generator calls and a logarithm each).
+	// A random word costs about 2/3 of a position, so the masks are used for the rates with few significant bits
+	// (e.g. 0.5, 0.25 or 0.375) and not for e.g. 0.3, which needs 32 random words per word of genes.
+	if (Random::BitsCost(rate) <= 96 * rate) {
+		BitWords::Word* words = BitWords::Get(pGenes);
+		size_t count = BitWords::Count(pGenes.size());
+		for (size_t i = 0; i + 1 < count; i++)
+			words[i] ^= BitWords::Word(Random::Bits(rate));
+		words[count - 1] ^= BitWords::Word(Random::Bits(rate)) & BitWords::LastMask(pGenes.size());
+		return;
+	}
+#endif
+	ForEachSampled(pGenes.size(), rate, [&pGenes] (size_t i) {
+		pGenes[i].flip();
+	});
+}
+#endif
+
 /**
  * Implementation of TypedMutator::DoApply(const Ptr<T>&)
  */
@@ -128,22 +231,8 @@ template<class T>
 ArrayGenomePtr<T> PointResetMutation<T>::DoApply(
 		const ArrayGenomePtr<T>& pTarget) {
 	auto genome = pTarget->Clone();
-
-	uniform_real_distribution<double> dist(0.0, 1.0);
-	vector<T>& genes = genome->GetGenes();
-	for (uint i = 0; i < genes.size(); i++)
-		if (mRate == 1.0 || dist(Random::generator) < mRate) {
-			if (mAllowDuplicate)
-				genes[i] = mRandomizer->Get();
-			else {
-				T oldGene = genes[i];
-				do
-					genes[i] = mRandomizer->Get();
-				while (genes[i] == oldGene);
-			}
-		}
+	MutateGenes(genome->GetGenes());
 	return genome;
 }
 
 } /* namespace ea */
-
@@ -20,27 +20,62 @@ namespace ea {
  * This operator guarantees that the new position is different than the old one.
  *
  * @method
- * Erase the chosen gene and then insert it to the genome again.
+ * Rotate the genes between the old and the new position by one. The first mutation is applied while copying
+ * the genes of the target.
  *
  * @time
  * O(N)
  *
  * @name{InsertMutation}
+ *
+ * @eaml
+ * @attr{count, uint - Optional - The number of mutations applied in one pass (default is 1).}
+ * @endeaml
  */
 
-InsertMutation::InsertMutation() {
+EA_TYPEINFO_CUSTOM_IMPL(InsertMutation) {
+	return *ea::TypeInfo("InsertMutation")
+		.Add("count", &InsertMutation::mCount)
+		->SetConstructor<InsertMutation>();
+}
+
+/**
+ * Create an InsertMutation.
+ * @param pCount The number of mutations applied in one pass.
+ */
+InsertMutation::InsertMutation(uint pCount) :
+		PermutationMutation(pCount) {
 }
 
 InsertMutation::~InsertMutation() {
 }
 
+#ifndef DOXYGEN_IGNORE
+// The gene at one end of the interval is moved to the other end,
+// so the ranges [first, middle) and [middle, last) exchange their places
+struct InsertMove {
+	uint first, middle, last;
+
+	InsertMove(uint lowerIndex, uint upperIndex) {
+		bool backward = Random::Bool();
+		first = lowerIndex;
+		middle = backward ? upperIndex : lowerIndex + 1;
+		last = upperIndex + 1;
+	}
+};
+#endif
+
 void InsertMutation::DoMutate(vector<uint>& genes, uint lowerIndex, uint upperIndex) {
-	if (Random::Bool())
-		std::swap(lowerIndex, upperIndex);
+	InsertMove move(lowerIndex, upperIndex);
+	rotate(genes.begin() + move.first, genes.begin() + move.middle, genes.begin() + move.last);
+}
 
-	uint temp = genes[lowerIndex];
-	genes.erase(genes.begin() + lowerIndex);
-	genes.insert(genes.begin() + upperIndex, temp);
+void InsertMutation::DoMutateCopy(const vector<uint>& source, vector<uint>& genes, uint lowerIndex, uint upperIndex) {
+	InsertMove move(lowerIndex, upperIndex);
+	genes.insert(genes.end(), source.begin(), source.begin() + move.first);
+	genes.insert(genes.end(), source.begin() + move.middle, source.begin() + move.last);
+	genes.insert(genes.end(), source.begin() + move.first, source.begin() + move.middle);
+	genes.insert(genes.end(), source.begin() + move.last, source.end());
 }
 
 } /* namespace ea */
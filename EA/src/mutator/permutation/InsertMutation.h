@@ -15,11 +15,13 @@ namespace ea {
 class InsertMutation: public PermutationMutation {
 protected:
 	virtual void DoMutate(vector<uint>& genes, uint lowerIndex, uint upperIndex) override;
+	virtual void DoMutateCopy(const vector<uint>& source, vector<uint>& genes, uint lowerIndex, uint upperIndex)
+			override;
 
 public:
-	EA_TYPEINFO_DEFAULT(InsertMutation)
+	EA_TYPEINFO_CUSTOM_DECL
 
-	InsertMutation();
+	InsertMutation(uint pCount = 1);
 	virtual ~InsertMutation();
 };
 
@@ -21,15 +21,30 @@ namespace ea {
  * That means the new genome will always be a different one.
  *
  * @method
- * Use std::reverse to reverse the segment.
+ * Use std::reverse to reverse the segment. The first mutation copies the segment of the target in reverse order.
  *
  * @time
  * O(N)
  *
  * @name{InversionMutation}
+ *
+ * @eaml
+ * @attr{count, uint - Optional - The number of mutations applied in one pass (default is 1).}
+ * @endeaml
  */
 
-InversionMutation::InversionMutation() {
+EA_TYPEINFO_CUSTOM_IMPL(InversionMutation) {
+	return *ea::TypeInfo("InversionMutation")
+		.Add("count", &InversionMutation::mCount)
+		->SetConstructor<InversionMutation>();
+}
+
+/**
+ * Create an InversionMutation.
+ * @param pCount The number of mutations applied in one pass.
+ */
+InversionMutation::InversionMutation(uint pCount) :
+		PermutationMutation(pCount) {
 }
 
 InversionMutation::~InversionMutation() {
@@ -39,4 +54,12 @@ void InversionMutation::DoMutate(vector<uint>& genes, uint lowerIndex, uint uppe
 	reverse(genes.begin() + lowerIndex, genes.begin() + upperIndex + 1);
 }
 
+void InversionMutation::DoMutateCopy(const vector<uint>& source, vector<uint>& genes, uint lowerIndex,
+		uint upperIndex) {
+	genes.insert(genes.end(), source.begin(), source.begin() + lowerIndex);
+	genes.insert(genes.end(), make_reverse_iterator(source.begin() + upperIndex + 1),
+			make_reverse_iterator(source.begin() + lowerIndex));
+	genes.insert(genes.end(), source.begin() + upperIndex + 1, source.end());
+}
+
 } /* namespace ea */
@@ -15,11 +15,13 @@ namespace ea {
 class InversionMutation: public PermutationMutation {
 protected:
 	virtual void DoMutate(vector<uint>& genes, uint lowerIndex, uint upperIndex) override;
+	virtual void DoMutateCopy(const vector<uint>& source, vector<uint>& genes, uint lowerIndex, uint upperIndex)
+			override;
 
 public:
-	EA_TYPEINFO_DEFAULT(InversionMutation)
+	EA_TYPEINFO_CUSTOM_DECL
 
-	InversionMutation();
+	InversionMutation(uint pCount = 1);
 	virtual ~InversionMutation();
 };
 
@@ -20,11 +20,35 @@ namespace ea {
  *
  * For real mutation operator implementation, see InsertMutation, InversionMutation, ScrambleMutation
  * and SwapMutation.
+ *
+ * The mutated genome is built in a single pass: the first mutation is applied while the genes are copied
+ * from the target (see DoMutateCopy()), then the other mutations (see GetCount()) are applied in place.
+ *
+ * @eaml
+ * @attr{count, uint - Optional - The number of mutations applied in one pass, each on its own random interval
+ * (default is 1).}
+ * @endeaml
+ */
+
+/**
+ * Create a PermutationMutation.
+ * @param pCount The number of mutations applied in one pass.
  */
+PermutationMutation::PermutationMutation(uint pCount) :
+		mCount(pCount) {
+}
 
 PermutationMutation::~PermutationMutation() {
 }
 
+/**
+ * Get the number of mutations applied in one pass.
+ * @return The number of mutations (at least 1 is applied).
+ */
+uint PermutationMutation::GetCount() const {
+	return mCount;
+}
+
 /**
  * @fn void PermutationMutation::DoMutate(vector<uint>& genes, uint lowerIndex, uint upperIndex)
  * Implementation of the mutation operator on PermutationGenome.
@@ -36,6 +60,22 @@ PermutationMutation::~PermutationMutation() {
  * @param upperIndex The upper bound of the interval.
  */
 
+/**
+ * Apply the mutation while copying the genes.
+ * Child classes can override this function to write the mutated genes directly instead of copying the source
+ * then mutating it in place (the default implementation). The random values must be drawn as in DoMutate().
+ *
+ * @param source The genes of the target, which must not be modified.
+ * @param genes The genes of the new genome, which are empty (with enough capacity).
+ * @param lowerIndex The lower bound of the interval.
+ * @param upperIndex The upper bound of the interval.
+ */
+void PermutationMutation::DoMutateCopy(const vector<uint>& source, vector<uint>& genes, uint lowerIndex,
+		uint upperIndex) {
+	genes.assign(source.begin(), source.end());
+	DoMutate(genes, lowerIndex, upperIndex);
+}
+
 /**
  * Specialized implementation to be compatible with TypedMutator.
  * This function will extract the array of genes, draw a random interval and call DoMutate() internally.
@@ -43,18 +83,25 @@ PermutationMutation::~PermutationMutation() {
  * @see TypedMutator::DoApply(const Ptr<T>&)
  */
 PermutationGenomePtr PermutationMutation::DoApply(const PermutationGenomePtr& pTarget) {
-	auto genome = pTarget->Clone();
-	vector<uint>& genes = genome->GetGenes();
+	const vector<uint>& source = pTarget->GetGenes();
 
-	uint genomeLength = genes.size();
+	uint genomeLength = source.size();
 	if (genomeLength < 2)
 		throw invalid_argument("PermutationMutation requires genome length greater than 1.");
 
+	auto genome = make_shared<PermutationGenome>();
+	vector<uint>& genes = genome->GetGenes();
+	genes.reserve(genomeLength);
+
 	// swap interval
 	auto interval = Random::OrderedPair<uint>(0, genomeLength - 1);
 
-	// mutate
-	DoMutate(genes, interval.first, interval.second);
+	// mutate while copying, then in place for the other mutations
+	DoMutateCopy(source, genes, interval.first, interval.second);
+	for (uint i = 1; i < mCount; i++) {
+		interval = Random::OrderedPair<uint>(0, genomeLength - 1);
+		DoMutate(genes, interval.first, interval.second);
+	}
 
 	return genome;
 }
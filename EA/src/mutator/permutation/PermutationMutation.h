@@ -15,11 +15,18 @@ namespace ea {
 
 class PermutationMutation: public TypedMutator<PermutationGenome> {
 protected:
+	uint mCount;
+
+	PermutationMutation(uint pCount = 1);
+
 	virtual PermutationGenomePtr DoApply(const PermutationGenomePtr& pTarget) override final;
 	virtual void DoMutate(vector<uint>& genes, uint lowerIndex, uint upperIndex) = 0;	// for permutations only
+	virtual void DoMutateCopy(const vector<uint>& source, vector<uint>& genes, uint lowerIndex, uint upperIndex);
 
 public:
 	virtual ~PermutationMutation();
+
+	uint GetCount() const;
 };
 
 } /* namespace ea */
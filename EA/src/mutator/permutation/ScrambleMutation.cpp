@@ -28,9 +28,24 @@ namespace ea {
  * O(N)
  *
  * @name{ScrambleMutation}
+ *
+ * @eaml
+ * @attr{count, uint - Optional - The number of mutations applied in one pass (default is 1).}
+ * @endeaml
  */
 
-ScrambleMutation::ScrambleMutation() {
+EA_TYPEINFO_CUSTOM_IMPL(ScrambleMutation) {
+	return *ea::TypeInfo("ScrambleMutation")
+		.Add("count", &ScrambleMutation::mCount)
+		->SetConstructor<ScrambleMutation>();
+}
+
+/**
+ * Create a ScrambleMutation.
+ * @param pCount The number of mutations applied in one pass.
+ */
+ScrambleMutation::ScrambleMutation(uint pCount) :
+		PermutationMutation(pCount) {
 }
 
 ScrambleMutation::~ScrambleMutation() {
@@ -17,9 +17,9 @@ protected:
 	virtual void DoMutate(vector<uint>& genes, uint lowerIndex, uint upperIndex) override;
 
 public:
-	EA_TYPEINFO_DEFAULT(ScrambleMutation)
+	EA_TYPEINFO_CUSTOM_DECL
 
-	ScrambleMutation();
+	ScrambleMutation(uint pCount = 1);
 	virtual ~ScrambleMutation();
 };
 
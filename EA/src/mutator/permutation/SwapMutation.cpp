@@ -27,9 +27,24 @@ namespace ea {
  * O(1)
  *
  * @name{SwapMutation}
+ *
+ * @eaml
+ * @attr{count, uint - Optional - The number of mutations applied in one pass (default is 1).}
+ * @endeaml
  */
 
-SwapMutation::SwapMutation() {
+EA_TYPEINFO_CUSTOM_IMPL(SwapMutation) {
+	return *ea::TypeInfo("SwapMutation")
+		.Add("count", &SwapMutation::mCount)
+		->SetConstructor<SwapMutation>();
+}
+
+/**
+ * Create a SwapMutation.
+ * @param pCount The number of mutations applied in one pass.
+ */
+SwapMutation::SwapMutation(uint pCount) :
+		PermutationMutation(pCount) {
 }
 
 SwapMutation::~SwapMutation() {
@@ -17,9 +17,9 @@ protected:
 	virtual void DoMutate(vector<uint>& genes, uint lowerIndex, uint upperIndex) override;
 
 public:
-	EA_TYPEINFO_DEFAULT(SwapMutation)
+	EA_TYPEINFO_CUSTOM_DECL
 
-	SwapMutation();
+	SwapMutation(uint pCount = 1);
 	virtual ~SwapMutation();
 };
 
@@ -0,0 +1,44 @@
+/*
+ * LeadingOnesFunction.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../../pch.h"
+#include "LeadingOnesFunction.h"
+
+namespace ea {
+
+/**
+ * @class LeadingOnesFunction
+ * The **LeadingOnes** problem on BoolArrayGenome: the fitness is the number of consecutive true genes
+ * from the beginning of the array. The optimum is N (all genes are true).
+ * Unlike OneMaxFunction, only the first false gene matters, so the problem is not separable.
+ *
+ * @time
+ * O(N)
+ *
+ * @name{LeadingOnesFunction}
+ */
+
+LeadingOnesFunction::LeadingOnesFunction() {
+}
+
+LeadingOnesFunction::~LeadingOnesFunction() {
+}
+
+/**
+ * This function is maximized.
+ * @return true.
+ */
+bool LeadingOnesFunction::IsMaximizer() {
+	return true;
+}
+
+double LeadingOnesFunction::DoScalarEvaluate(InputType pGenome) {
+	auto& genes = pGenome->GetGenes();
+	return find(genes.begin(), genes.end(), false) - genes.begin();
+}
+
+} /* namespace ea */
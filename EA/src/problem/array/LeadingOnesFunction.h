@@ -0,0 +1,29 @@
+/*
+ * LeadingOnesFunction.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../../Type.h"
+#include "../../evaluator/TypedScalarEvaluator.h"
+#include "../../genome/ArrayGenome.h"
+
+namespace ea {
+
+class LeadingOnesFunction: public TypedScalarEvaluator<BoolArrayGenome> {
+public:
+	EA_TYPEINFO_DEFAULT(LeadingOnesFunction)
+
+	LeadingOnesFunction();
+	virtual ~LeadingOnesFunction();
+
+	virtual bool IsMaximizer() override;
+
+protected:
+	virtual double DoScalarEvaluate(InputType pGenome) override;
+};
+
+} /* namespace ea */
@@ -0,0 +1,122 @@
+/*
+ * NKLandscapeFunction.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../../pch.h"
+#include "NKLandscapeFunction.h"
+
+namespace ea {
+
+/**
+ * @class NKLandscapeFunction
+ * The **NK-landscape** problem on BoolArrayGenome, with tunable ruggedness.
+ * The fitness is the mean of N contributions in [0, 1). The contribution of the gene i depends on the gene itself and
+ * on its K next neighbours (circularly), and is read from a random table. K = 0 gives a separable problem similar
+ * to OneMaxFunction, larger K gives more epistasis and more local optima. The optimum is not known in general.
+ *
+ * The table is generated from the seed when the first genome is evaluated, which determines N.
+ * All the genomes must have the same size. The same seed always gives the same instance.
+ *
+ * @method
+ * The indices of the contributions are computed with a sliding window of K + 1 bits.
+ *
+ * @time
+ * O(N)
+ *
+ * @name{NKLandscapeFunction}
+ *
+ * @eaml
+ * @attr{k, uint - Optional - The number of neighbours of each gene (default is 2, at most 20).}
+ * @attr{seed, ullong - Optional - The seed of the contribution table (default is 0).}
+ * @endeaml
+ */
+
+EA_TYPEINFO_CUSTOM_IMPL(NKLandscapeFunction) {
+	return *ea::TypeInfo("NKLandscapeFunction")
+		.Add("k", &NKLandscapeFunction::mK)
+		->Add("seed", &NKLandscapeFunction::mSeed)
+		->SetConstructor<NKLandscapeFunction>();
+}
+
+/**
+ * Create an NKLandscapeFunction.
+ * @param pK The number of neighbours of each gene.
+ * @param pSeed The seed of the contribution table.
+ */
+NKLandscapeFunction::NKLandscapeFunction(uint pK, ullong pSeed) :
+		mK(pK), mSeed(pSeed), mSetupFlag(), mSize(0), mTable() {
+}
+
+NKLandscapeFunction::~NKLandscapeFunction() {
+}
+
+/**
+ * This function is maximized.
+ * @return true.
+ */
+bool NKLandscapeFunction::IsMaximizer() {
+	return true;
+}
+
+/**
+ * Get the number of neighbours of each gene.
+ * @return K.
+ */
+uint NKLandscapeFunction::GetK() const {
+	return mK;
+}
+
+/**
+ * Get the seed of the contribution table.
+ * @return The seed.
+ */
+ullong NKLandscapeFunction::GetSeed() const {
+	return mSeed;
+}
+
+double NKLandscapeFunction::DoScalarEvaluate(InputType pGenome) {
+	auto& genes = pGenome->GetGenes();
+	uint n = genes.size();
+	Prepare(n);
+	if (n == 0)
+		return 0;
+
+	// Bit j of the window is the gene (i + j) mod N
+	uint window = 0;
+	for (uint j = 0; j <= mK; j++)
+		window |= uint(genes[j % n]) << j;
+
+	const uint width = mK + 1;
+	double sum = 0;
+	for (uint i = 0; i < n; i++) {
+		sum += mTable[(size_t(i) << width) | window];
+		window = (window >> 1) | (uint(genes[(i + width) % n]) << mK);
+	}
+	return sum / n;
+}
+
+void NKLandscapeFunction::Prepare(uint pSize) {
+	call_once(mSetupFlag, [this, pSize] () {
+		if (mK > 20 || (pSize > 0 && mK >= pSize))
+			throw EA_EXCEPTION(EAException, OTHERS,
+					"NKLandscapeFunction: K = " + to_string(mK) + " must be less than N = " + to_string(pSize)
+							+ " and at most 20.");
+
+		default_random_engine generator(mSeed);
+		uniform_real_distribution<double> uniform(0, 1);
+		mTable.resize(size_t(pSize) << (mK + 1));
+		for (double& value : mTable)
+			value = uniform(generator);
+		mSize = pSize;
+	});
+
+	if (pSize != mSize)
+		throw EA_EXCEPTION(EAException, OTHERS,
+				"NKLandscapeFunction has N = " + to_string(mSize) + " but received a genome of size "
+						+ to_string(pSize) + ".");
+}
+
+} /* namespace ea */
@@ -0,0 +1,43 @@
+/*
+ * NKLandscapeFunction.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../../Type.h"
+#include "../../evaluator/TypedScalarEvaluator.h"
+#include "../../genome/ArrayGenome.h"
+#include <mutex>
+
+namespace ea {
+
+class NKLandscapeFunction: public TypedScalarEvaluator<BoolArrayGenome> {
+public:
+	EA_TYPEINFO_CUSTOM_DECL
+
+	NKLandscapeFunction(uint pK = 2, ullong pSeed = 0);
+	virtual ~NKLandscapeFunction();
+
+	virtual bool IsMaximizer() override;
+
+	uint GetK() const;
+	ullong GetSeed() const;
+
+protected:
+	virtual double DoScalarEvaluate(InputType pGenome) override;
+
+private:
+	uint mK;
+	ullong mSeed;
+
+	once_flag mSetupFlag;
+	uint mSize;
+	vector<double> mTable;
+
+	void Prepare(uint pSize);
+};
+
+} /* namespace ea */
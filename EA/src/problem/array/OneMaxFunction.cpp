@@ -0,0 +1,43 @@
+/*
+ * OneMaxFunction.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../../pch.h"
+#include "OneMaxFunction.h"
+
+namespace ea {
+
+/**
+ * @class OneMaxFunction
+ * The **OneMax** problem on BoolArrayGenome: the fitness is the number of true genes.
+ * The optimum is N (all genes are true).
+ *
+ * @time
+ * O(N)
+ *
+ * @name{OneMaxFunction}
+ */
+
+OneMaxFunction::OneMaxFunction() {
+}
+
+OneMaxFunction::~OneMaxFunction() {
+}
+
+/**
+ * This function is maximized.
+ * @return true.
+ */
+bool OneMaxFunction::IsMaximizer() {
+	return true;
+}
+
+double OneMaxFunction::DoScalarEvaluate(InputType pGenome) {
+	auto& genes = pGenome->GetGenes();
+	return count(genes.begin(), genes.end(), true);
+}
+
+} /* namespace ea */
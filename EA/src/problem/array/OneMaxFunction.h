@@ -0,0 +1,29 @@
+/*
+ * OneMaxFunction.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../../Type.h"
+#include "../../evaluator/TypedScalarEvaluator.h"
+#include "../../genome/ArrayGenome.h"
+
+namespace ea {
+
+class OneMaxFunction: public TypedScalarEvaluator<BoolArrayGenome> {
+public:
+	EA_TYPEINFO_DEFAULT(OneMaxFunction)
+
+	OneMaxFunction();
+	virtual ~OneMaxFunction();
+
+	virtual bool IsMaximizer() override;
+
+protected:
+	virtual double DoScalarEvaluate(InputType pGenome) override;
+};
+
+} /* namespace ea */
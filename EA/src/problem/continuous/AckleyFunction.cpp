@@ -0,0 +1,61 @@
+/*
+ * AckleyFunction.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../../pch.h"
+#include "AckleyFunction.h"
+
+namespace ea {
+
+using namespace Eigen;
+
+/**
+ * @class AckleyFunction
+ * The **Ackley** function
+ * \f$f(z) = -20\exp(-0.2\sqrt{\frac{1}{N}\sum_i z_i^2}) - \exp(\frac{1}{N}\sum_i\cos(2\pi z_i)) + 20 + e\f$.
+ * It is multimodal with a nearly flat outer region and a deep funnel around the optimum.
+ * The usual search space is \f$[-32.768, 32.768]^N\f$.
+ *
+ * See ContinuousFunction for the shift and the rotation.
+ *
+ * @name{AckleyFunction}
+ *
+ * @eaml
+ * @attr{shift, double - Optional - The magnitude of the random shift (default is 0 - not shifted).}
+ * @attr{rotated, bool - Optional - Whether the function is rotated (default is false).}
+ * @attr{seed, ullong - Optional - The seed of the shift vector and the rotation matrix (default is 0).}
+ * @endeaml
+ */
+
+EA_TYPEINFO_CUSTOM_IMPL(AckleyFunction) {
+	return *ea::TypeInfo("AckleyFunction")
+		.Add("shift", &AckleyFunction::mShift)
+		->Add("rotated", &AckleyFunction::mRotated)
+		->Add("seed", &AckleyFunction::mSeed)
+		->SetConstructor<AckleyFunction>();
+}
+
+/**
+ * Create an AckleyFunction.
+ * @param pShift The magnitude of the random shift (0 for not shifted).
+ * @param pRotated Whether the function is rotated.
+ * @param pSeed The seed of the shift vector and the rotation matrix.
+ */
+AckleyFunction::AckleyFunction(double pShift, bool pRotated, ullong pSeed) :
+		ContinuousFunction(pShift, pRotated, pSeed) {
+}
+
+AckleyFunction::~AckleyFunction() {
+}
+
+double AckleyFunction::DoCompute(const Ref<const ArrayXd>& pZ) const {
+	if (pZ.size() == 0)
+		return 0;
+	double n = pZ.size();
+	return -20 * exp(-0.2 * sqrt(pZ.square().sum() / n)) - exp((2 * M_PI * pZ).cos().sum() / n) + 20 + M_E;
+}
+
+} /* namespace ea */
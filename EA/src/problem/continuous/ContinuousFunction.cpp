@@ -0,0 +1,182 @@
+/*
+ * ContinuousFunction.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../../pch.h"
+#include "ContinuousFunction.h"
+
+namespace ea {
+
+using namespace Eigen;
+
+/**
+ * @class ContinuousFunction
+ * The base class of the built-in continuous benchmark functions, which are minimized on DoubleArrayGenome.
+ *
+ * A genome \f$x\f$ is evaluated as \f$f(z)\f$ with \f$z = R(x - o)\f$, where \f$o\f$ is a shift vector drawn
+ * uniformly from \f$[-shift, shift]^N\f$ and \f$R\f$ is a random orthogonal matrix (the identity if not rotated).
+ * Every function has its minimum 0 at \f$x = o\f$, so a shifted function no longer has its optimum at the origin
+ * and a rotated one is no longer separable. The shift vector and the rotation matrix are generated from the seed
+ * when the first genome is evaluated, which determines the dimension. All the genomes must have the same size.
+ *
+ * The same seed always gives the same instance, independently of the seed of the evolution.
+ *
+ * Child classes implement DoCompute() on the transformed vector with Eigen array expressions,
+ * so the evaluation is vectorized.
+ *
+ * @method
+ * The rotation matrix is the Q factor of the QR decomposition of a Gaussian matrix (with the signs of its columns
+ * corrected so that it is uniformly distributed). The transformed vector is kept in a thread-local buffer.
+ *
+ * @time
+ * O(N) without rotation, O(N^2) with rotation.
+ *
+ * @eaml
+ * @attr{shift, double - Optional - The magnitude of the random shift (default is 0 - not shifted).}
+ * @attr{rotated, bool - Optional - Whether the function is rotated (default is false).}
+ * @attr{seed, ullong - Optional - The seed of the shift vector and the rotation matrix (default is 0).}
+ * @endeaml
+ */
+
+/**
+ * Create a ContinuousFunction.
+ * @param pShift The magnitude of the random shift (0 for not shifted).
+ * @param pRotated Whether the function is rotated.
+ * @param pSeed The seed of the shift vector and the rotation matrix.
+ */
+ContinuousFunction::ContinuousFunction(double pShift, bool pRotated, ullong pSeed) :
+		mShift(pShift), mRotated(pRotated), mSeed(pSeed), mSetupFlag(), mDimension(0), mShiftVector(), mRotation() {
+}
+
+ContinuousFunction::~ContinuousFunction() {
+}
+
+/**
+ * The benchmark functions are minimized.
+ * @return false.
+ */
+bool ContinuousFunction::IsMaximizer() {
+	return false;
+}
+
+/**
+ * Get the magnitude of the random shift.
+ * @return The magnitude of the shift (0 if not shifted).
+ */
+double ContinuousFunction::GetShift() const {
+	return mShift;
+}
+
+/**
+ * Whether the function is rotated.
+ * @return true if rotated.
+ */
+bool ContinuousFunction::IsRotated() const {
+	return mRotated;
+}
+
+/**
+ * Get the seed of the shift vector and the rotation matrix.
+ * @return The seed.
+ */
+ullong ContinuousFunction::GetSeed() const {
+	return mSeed;
+}
+
+/**
+ * Get the dimension of the function.
+ * @return The dimension, which is 0 until the first evaluation.
+ */
+uint ContinuousFunction::GetDimension() const {
+	return mDimension;
+}
+
+/**
+ * Get the shift vector, which is the optimal solution.
+ * @return The shift vector (empty until the first evaluation).
+ */
+const VectorXd& ContinuousFunction::GetShiftVector() const {
+	return mShiftVector;
+}
+
+/**
+ * Get the rotation matrix.
+ * @return The rotation matrix (empty until the first evaluation or if not rotated).
+ */
+const MatrixXd& ContinuousFunction::GetRotationMatrix() const {
+	return mRotation;
+}
+
+/**
+ * Compute the function value of a vector without wrapping it in a genome.
+ * @param pX The vector.
+ * @param pDimension The size of the vector.
+ * @return The function value.
+ */
+double ContinuousFunction::Compute(const double* pX, uint pDimension) {
+	Prepare(pDimension);
+
+	Map<const ArrayXd> x(pX, pDimension);
+	if (!mRotated && mShift == 0)
+		return DoCompute(x);
+
+	thread_local ArrayXd z;
+	if (mRotated)
+		z.matrix().noalias() = mRotation * (x.matrix() - mShiftVector);
+	else
+		z = x - mShiftVector.array();
+	return DoCompute(z);
+}
+
+double ContinuousFunction::DoScalarEvaluate(InputType pGenome) {
+	auto& genes = pGenome->GetGenes();
+	return Compute(genes.data(), genes.size());
+}
+
+/**
+ * Prepare the data which depends on the dimension.
+ * This function is called once, before the first evaluation.
+ * @param pDimension The dimension of the function.
+ */
+void ContinuousFunction::Setup(uint pDimension) {
+}
+
+void ContinuousFunction::Prepare(uint pDimension) {
+	call_once(mSetupFlag, [this, pDimension] () {
+		default_random_engine generator(mSeed);
+
+		mShiftVector = VectorXd::Zero(pDimension);
+		if (mShift != 0) {
+			uniform_real_distribution<double> uniform(-mShift, mShift);
+			for (uint i = 0; i < pDimension; i++)
+				mShiftVector(i) = uniform(generator);
+		}
+
+		if (mRotated) {
+			normal_distribution<double> normal;
+			MatrixXd gaussian(pDimension, pDimension);
+			for (uint j = 0; j < pDimension; j++)
+				for (uint i = 0; i < pDimension; i++)
+					gaussian(i, j) = normal(generator);
+
+			HouseholderQR<MatrixXd> qr(gaussian);
+			mRotation = qr.householderQ();
+			for (uint j = 0; j < pDimension; j++)
+				if (qr.matrixQR()(j, j) < 0)
+					mRotation.col(j) *= -1;
+		}
+
+		Setup(pDimension);
+		mDimension = pDimension;
+	});
+
+	if (pDimension != mDimension)
+		throw EA_EXCEPTION(EAException, OTHERS,
+				GetTypeNameSafe("This ContinuousFunction") + " has dimension " + to_string(mDimension)
+						+ " but received a genome of size " + to_string(pDimension) + ".");
+}
+
+} /* namespace ea */
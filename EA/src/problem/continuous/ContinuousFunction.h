@@ -0,0 +1,54 @@
+/*
+ * ContinuousFunction.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../../Type.h"
+#include "../../evaluator/TypedScalarEvaluator.h"
+#include "../../genome/ArrayGenome.h"
+#include <eigen3/Eigen/Dense>
+#include <mutex>
+
+namespace ea {
+
+class ContinuousFunction: public TypedScalarEvaluator<DoubleArrayGenome> {
+public:
+	ContinuousFunction(double pShift = 0, bool pRotated = false, ullong pSeed = 0);
+	virtual ~ContinuousFunction();
+
+	virtual bool IsMaximizer() override;
+
+	double GetShift() const;
+	bool IsRotated() const;
+	ullong GetSeed() const;
+
+	uint GetDimension() const;
+	const Eigen::VectorXd& GetShiftVector() const;
+	const Eigen::MatrixXd& GetRotationMatrix() const;
+
+	double Compute(const double* pX, uint pDimension);
+
+protected:
+	virtual double DoScalarEvaluate(InputType pGenome) override;
+
+	virtual void Setup(uint pDimension);
+	virtual double DoCompute(const Eigen::Ref<const Eigen::ArrayXd>& pZ) const = 0;
+
+	double mShift;
+	bool mRotated;
+	ullong mSeed;
+
+private:
+	once_flag mSetupFlag;
+	uint mDimension;
+	Eigen::VectorXd mShiftVector;
+	Eigen::MatrixXd mRotation;
+
+	void Prepare(uint pDimension);
+};
+
+} /* namespace ea */
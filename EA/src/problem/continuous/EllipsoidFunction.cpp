@@ -0,0 +1,63 @@
+/*
+ * EllipsoidFunction.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../../pch.h"
+#include "EllipsoidFunction.h"
+
+namespace ea {
+
+using namespace Eigen;
+
+/**
+ * @class EllipsoidFunction
+ * The **ellipsoid** function \f$f(z) = \sum_i 10^{6\frac{i}{N-1}} z_i^2\f$.
+ * It is unimodal and ill-conditioned (the condition number is \f$10^6\f$), which rewards the strategies
+ * adapting the shape of their search distribution (e.g. CMAEvolutionStrategy).
+ *
+ * See ContinuousFunction for the shift and the rotation.
+ *
+ * @name{EllipsoidFunction}
+ *
+ * @eaml
+ * @attr{shift, double - Optional - The magnitude of the random shift (default is 0 - not shifted).}
+ * @attr{rotated, bool - Optional - Whether the function is rotated (default is false).}
+ * @attr{seed, ullong - Optional - The seed of the shift vector and the rotation matrix (default is 0).}
+ * @endeaml
+ */
+
+EA_TYPEINFO_CUSTOM_IMPL(EllipsoidFunction) {
+	return *ea::TypeInfo("EllipsoidFunction")
+		.Add("shift", &EllipsoidFunction::mShift)
+		->Add("rotated", &EllipsoidFunction::mRotated)
+		->Add("seed", &EllipsoidFunction::mSeed)
+		->SetConstructor<EllipsoidFunction>();
+}
+
+/**
+ * Create an EllipsoidFunction.
+ * @param pShift The magnitude of the random shift (0 for not shifted).
+ * @param pRotated Whether the function is rotated.
+ * @param pSeed The seed of the shift vector and the rotation matrix.
+ */
+EllipsoidFunction::EllipsoidFunction(double pShift, bool pRotated, ullong pSeed) :
+		ContinuousFunction(pShift, pRotated, pSeed), mWeights() {
+}
+
+EllipsoidFunction::~EllipsoidFunction() {
+}
+
+void EllipsoidFunction::Setup(uint pDimension) {
+	mWeights.resize(pDimension);
+	for (uint i = 0; i < pDimension; i++)
+		mWeights(i) = pow(1e6, pDimension > 1 ? double(i) / (pDimension - 1) : 0);
+}
+
+double EllipsoidFunction::DoCompute(const Ref<const ArrayXd>& pZ) const {
+	return (mWeights * pZ.square()).sum();
+}
+
+} /* namespace ea */
@@ -0,0 +1,30 @@
+/*
+ * EllipsoidFunction.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../../Type.h"
+#include "ContinuousFunction.h"
+
+namespace ea {
+
+class EllipsoidFunction: public ContinuousFunction {
+public:
+	EA_TYPEINFO_CUSTOM_DECL
+
+	EllipsoidFunction(double pShift = 0, bool pRotated = false, ullong pSeed = 0);
+	virtual ~EllipsoidFunction();
+
+protected:
+	virtual void Setup(uint pDimension) override;
+	virtual double DoCompute(const Eigen::Ref<const Eigen::ArrayXd>& pZ) const override;
+
+private:
+	Eigen::ArrayXd mWeights;
+};
+
+} /* namespace ea */
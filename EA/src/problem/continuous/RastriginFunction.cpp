@@ -0,0 +1,56 @@
+/*
+ * RastriginFunction.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../../pch.h"
+#include "RastriginFunction.h"
+
+namespace ea {
+
+using namespace Eigen;
+
+/**
+ * @class RastriginFunction
+ * The **Rastrigin** function \f$f(z) = 10N + \sum_i (z_i^2 - 10\cos(2\pi z_i))\f$.
+ * It is highly multimodal, with a regular grid of local optima. The usual search space is \f$[-5.12, 5.12]^N\f$.
+ *
+ * See ContinuousFunction for the shift and the rotation.
+ *
+ * @name{RastriginFunction}
+ *
+ * @eaml
+ * @attr{shift, double - Optional - The magnitude of the random shift (default is 0 - not shifted).}
+ * @attr{rotated, bool - Optional - Whether the function is rotated (default is false).}
+ * @attr{seed, ullong - Optional - The seed of the shift vector and the rotation matrix (default is 0).}
+ * @endeaml
+ */
+
+EA_TYPEINFO_CUSTOM_IMPL(RastriginFunction) {
+	return *ea::TypeInfo("RastriginFunction")
+		.Add("shift", &RastriginFunction::mShift)
+		->Add("rotated", &RastriginFunction::mRotated)
+		->Add("seed", &RastriginFunction::mSeed)
+		->SetConstructor<RastriginFunction>();
+}
+
+/**
+ * Create a RastriginFunction.
+ * @param pShift The magnitude of the random shift (0 for not shifted).
+ * @param pRotated Whether the function is rotated.
+ * @param pSeed The seed of the shift vector and the rotation matrix.
+ */
+RastriginFunction::RastriginFunction(double pShift, bool pRotated, ullong pSeed) :
+		ContinuousFunction(pShift, pRotated, pSeed) {
+}
+
+RastriginFunction::~RastriginFunction() {
+}
+
+double RastriginFunction::DoCompute(const Ref<const ArrayXd>& pZ) const {
+	return 10.0 * pZ.size() + (pZ.square() - 10 * (2 * M_PI * pZ).cos()).sum();
+}
+
+} /* namespace ea */
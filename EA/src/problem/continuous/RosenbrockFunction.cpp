@@ -0,0 +1,61 @@
+/*
+ * RosenbrockFunction.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../../pch.h"
+#include "RosenbrockFunction.h"
+
+namespace ea {
+
+using namespace Eigen;
+
+/**
+ * @class RosenbrockFunction
+ * The **Rosenbrock** function \f$f(z) = \sum_{i=1}^{N-1} 100(y_{i+1} - y_i^2)^2 + (1 - y_i)^2\f$ with \f$y = z + 1\f$.
+ * Its optimum lies at the end of a long curved valley. The translation by 1 moves the optimum to \f$z = 0\f$,
+ * like the other functions.
+ *
+ * See ContinuousFunction for the shift and the rotation.
+ *
+ * @name{RosenbrockFunction}
+ *
+ * @eaml
+ * @attr{shift, double - Optional - The magnitude of the random shift (default is 0 - not shifted).}
+ * @attr{rotated, bool - Optional - Whether the function is rotated (default is false).}
+ * @attr{seed, ullong - Optional - The seed of the shift vector and the rotation matrix (default is 0).}
+ * @endeaml
+ */
+
+EA_TYPEINFO_CUSTOM_IMPL(RosenbrockFunction) {
+	return *ea::TypeInfo("RosenbrockFunction")
+		.Add("shift", &RosenbrockFunction::mShift)
+		->Add("rotated", &RosenbrockFunction::mRotated)
+		->Add("seed", &RosenbrockFunction::mSeed)
+		->SetConstructor<RosenbrockFunction>();
+}
+
+/**
+ * Create a RosenbrockFunction.
+ * @param pShift The magnitude of the random shift (0 for not shifted).
+ * @param pRotated Whether the function is rotated.
+ * @param pSeed The seed of the shift vector and the rotation matrix.
+ */
+RosenbrockFunction::RosenbrockFunction(double pShift, bool pRotated, ullong pSeed) :
+		ContinuousFunction(pShift, pRotated, pSeed) {
+}
+
+RosenbrockFunction::~RosenbrockFunction() {
+}
+
+double RosenbrockFunction::DoCompute(const Ref<const ArrayXd>& pZ) const {
+	if (pZ.size() < 2)
+		return 0;
+	auto y = pZ + 1;
+	auto head = y.head(pZ.size() - 1);
+	return (100 * (y.tail(pZ.size() - 1) - head.square()).square() + (1 - head).square()).sum();
+}
+
+} /* namespace ea */
@@ -0,0 +1,26 @@
+/*
+ * RosenbrockFunction.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../../Type.h"
+#include "ContinuousFunction.h"
+
+namespace ea {
+
+class RosenbrockFunction: public ContinuousFunction {
+public:
+	EA_TYPEINFO_CUSTOM_DECL
+
+	RosenbrockFunction(double pShift = 0, bool pRotated = false, ullong pSeed = 0);
+	virtual ~RosenbrockFunction();
+
+protected:
+	virtual double DoCompute(const Eigen::Ref<const Eigen::ArrayXd>& pZ) const override;
+};
+
+} /* namespace ea */
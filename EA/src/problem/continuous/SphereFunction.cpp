@@ -0,0 +1,56 @@
+/*
+ * SphereFunction.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../../pch.h"
+#include "SphereFunction.h"
+
+namespace ea {
+
+using namespace Eigen;
+
+/**
+ * @class SphereFunction
+ * The **sphere** function \f$f(z) = \sum_i z_i^2\f$.
+ * It is unimodal and separable (if not rotated), the easiest of the continuous benchmark functions.
+ *
+ * See ContinuousFunction for the shift and the rotation.
+ *
+ * @name{SphereFunction}
+ *
+ * @eaml
+ * @attr{shift, double - Optional - The magnitude of the random shift (default is 0 - not shifted).}
+ * @attr{rotated, bool - Optional - Whether the function is rotated (default is false).}
+ * @attr{seed, ullong - Optional - The seed of the shift vector and the rotation matrix (default is 0).}
+ * @endeaml
+ */
+
+EA_TYPEINFO_CUSTOM_IMPL(SphereFunction) {
+	return *ea::TypeInfo("SphereFunction")
+		.Add("shift", &SphereFunction::mShift)
+		->Add("rotated", &SphereFunction::mRotated)
+		->Add("seed", &SphereFunction::mSeed)
+		->SetConstructor<SphereFunction>();
+}
+
+/**
+ * Create a SphereFunction.
+ * @param pShift The magnitude of the random shift (0 for not shifted).
+ * @param pRotated Whether the function is rotated.
+ * @param pSeed The seed of the shift vector and the rotation matrix.
+ */
+SphereFunction::SphereFunction(double pShift, bool pRotated, ullong pSeed) :
+		ContinuousFunction(pShift, pRotated, pSeed) {
+}
+
+SphereFunction::~SphereFunction() {
+}
+
+double SphereFunction::DoCompute(const Ref<const ArrayXd>& pZ) const {
+	return pZ.square().sum();
+}
+
+} /* namespace ea */
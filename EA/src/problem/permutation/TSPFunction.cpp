@@ -0,0 +1,127 @@
+/*
+ * TSPFunction.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../../pch.h"
+#include "TSPFunction.h"
+
+namespace ea {
+
+/**
+ * @class TSPFunction
+ * A random instance of the **Travelling Salesman Problem** on PermutationGenome.
+ * The cities are drawn uniformly in the unit square and the fitness is the length of the closed tour
+ * which visits them in the order of the permutation. The length of the optimal tour of N random cities is about
+ * \f$0.7124\sqrt{N}\f$ for large N.
+ *
+ * The cities are generated from the seed when the first genome is evaluated, which determines N.
+ * All the genomes must have the same size. The same seed always gives the same instance.
+ *
+ * @time
+ * O(N)
+ *
+ * @name{TSPFunction}
+ *
+ * @eaml
+ * @attr{seed, ullong - Optional - The seed of the cities (default is 0).}
+ * @endeaml
+ */
+
+EA_TYPEINFO_CUSTOM_IMPL(TSPFunction) {
+	return *ea::TypeInfo("TSPFunction")
+		.Add("seed", &TSPFunction::mSeed)
+		->SetConstructor<TSPFunction>();
+}
+
+/**
+ * Create a TSPFunction.
+ * @param pSeed The seed of the cities.
+ */
+TSPFunction::TSPFunction(ullong pSeed) :
+		mSeed(pSeed), mSetupFlag(), mSize(0), mX(), mY() {
+}
+
+TSPFunction::~TSPFunction() {
+}
+
+/**
+ * The tour length is minimized.
+ * @return false.
+ */
+bool TSPFunction::IsMaximizer() {
+	return false;
+}
+
+/**
+ * Get the seed of the cities.
+ * @return The seed.
+ */
+ullong TSPFunction::GetSeed() const {
+	return mSeed;
+}
+
+/**
+ * Get the number of cities.
+ * @return The number of cities, which is 0 until the first evaluation.
+ */
+uint TSPFunction::GetSize() const {
+	return mSize;
+}
+
+/**
+ * Get the x-coordinates of the cities.
+ * @return The x-coordinates (empty until the first evaluation).
+ */
+const vector<double>& TSPFunction::GetX() const {
+	return mX;
+}
+
+/**
+ * Get the y-coordinates of the cities.
+ * @return The y-coordinates (empty until the first evaluation).
+ */
+const vector<double>& TSPFunction::GetY() const {
+	return mY;
+}
+
+double TSPFunction::DoScalarEvaluate(InputType pGenome) {
+	auto& genes = pGenome->GetGenes();
+	uint n = genes.size();
+	Prepare(n);
+	if (n < 2)
+		return 0;
+
+	double length = 0;
+	uint prev = genes[n - 1];
+	for (uint city : genes) {
+		double dx = mX[city] - mX[prev];
+		double dy = mY[city] - mY[prev];
+		length += sqrt(dx * dx + dy * dy);
+		prev = city;
+	}
+	return length;
+}
+
+void TSPFunction::Prepare(uint pSize) {
+	call_once(mSetupFlag, [this, pSize] () {
+		default_random_engine generator(mSeed);
+		uniform_real_distribution<double> uniform(0, 1);
+		mX.resize(pSize);
+		mY.resize(pSize);
+		for (uint i = 0; i < pSize; i++) {
+			mX[i] = uniform(generator);
+			mY[i] = uniform(generator);
+		}
+		mSize = pSize;
+	});
+
+	if (pSize != mSize)
+		throw EA_EXCEPTION(EAException, OTHERS,
+				"TSPFunction has " + to_string(mSize) + " cities but received a genome of size "
+						+ to_string(pSize) + ".");
+}
+
+} /* namespace ea */
@@ -0,0 +1,45 @@
+/*
+ * TSPFunction.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../../Type.h"
+#include "../../evaluator/TypedScalarEvaluator.h"
+#include "../../genome/PermutationGenome.h"
+#include <mutex>
+
+namespace ea {
+
+class TSPFunction: public TypedScalarEvaluator<PermutationGenome> {
+public:
+	EA_TYPEINFO_CUSTOM_DECL
+
+	TSPFunction(ullong pSeed = 0);
+	virtual ~TSPFunction();
+
+	virtual bool IsMaximizer() override;
+
+	ullong GetSeed() const;
+	uint GetSize() const;
+	const vector<double>& GetX() const;
+	const vector<double>& GetY() const;
+
+protected:
+	virtual double DoScalarEvaluate(InputType pGenome) override;
+
+private:
+	ullong mSeed;
+
+	once_flag mSetupFlag;
+	uint mSize;
+	vector<double> mX;
+	vector<double> mY;
+
+	void Prepare(uint pSize);
+};
+
+} /* namespace ea */
@@ -10,6 +10,7 @@
 #include "../../EA/Type/Array.h"
 #include "../../core/interface/Recombinator.h"
 #include "../../genome/ArrayGenome.h"
+#include "../../misc/BitWords.h"
 
 namespace ea {
 
@@ -32,7 +33,9 @@ template<class T, uint ... N> class NPointCrossover;
  * @tparam T Type of genes.
  *
  * @method
- * Draw split points randomly. Then iterate through the array of genes, switch parent if encounter a split point.
+ * Draw the split points without replacement with Floyd's algorithm (marking the drawn points in a thread-local buffer),
+ * then sort them. The child starts as a copy of the parent which gives the last segment,
+ * then the segments of the other parent are copied in place (by machine words for \ref BoolNPointCrossover).
  *
  * @time
  * O(L + NlogN) with L is the length of input genomes and N is the number of split points.
@@ -50,6 +53,8 @@ class NPointCrossover<T> : public Recombinator {
 private:
 	uint mCrossCount;
 
+	static void CopyRange(vector<T>& pGenes, const vector<T>& pOther, size_t pBegin, size_t pEnd);
+
 protected:
 	virtual GenomePtr DoCombine(vector<GenomePtr>& pParents) override;
 
@@ -94,7 +99,7 @@ EA_TYPEINFO_SPECIALIZED_INLINE(NPointCrossover, double) {
 
 template<class T>
 GenomePtr NPointCrossover<T>::DoCombine(vector<GenomePtr>& pParents) {
-	vector<vector<T>*> genomes(pParents.size());
+	vector<ArrayGenomePtr<T>> genomes(pParents.size());
 	transform(pParents.begin(), pParents.end(), genomes.begin(),
 			[this](GenomePtr parent) {
 				ArrayGenomePtr<T> genome = dynamic_pointer_cast<ArrayGenome<T>>(parent);
@@ -105,41 +110,52 @@ GenomePtr NPointCrossover<T>::DoCombine(vector<GenomePtr>& pParents) {
 				throw invalid_argument(
 						"All input parents for " + to_string(mCrossCount) +
 						"-PointCrossover must have at least " + to_string(mCrossCount + 1) + " genes.");
-				return &genome->GetGenes();
+				return genome;
 			});
 
-	uint minSize = min((*genomes[0]).size(), (*genomes[1]).size());
-	vector<uint> crossPoints;
-	if (mCrossCount == 1) {
-		uniform_int_distribution<uint> dist(1, minSize - 1);
-		crossPoints = {0, dist(Random::generator)};
-	}
-	else {
-		crossPoints = vector<uint>(minSize - 1);
-		iota(crossPoints.begin(), crossPoints.end(), 1);
-		shuffle(crossPoints.begin(), crossPoints.end(), Random::generator);
-		crossPoints.erase(crossPoints.begin() + mCrossCount, crossPoints.end());
-		sort(crossPoints.begin(), crossPoints.end());
-		crossPoints.insert(crossPoints.begin(), 0);
+	// Floyd's algorithm: draw mCrossCount distinct points in [1, minSize - 1]
+	uint minSize = min(genomes[0]->GetSize(), genomes[1]->GetSize());
+	thread_local vector<bool> drawn;
+	thread_local vector<uint> crossPoints;
+	if (drawn.size() < minSize)
+		drawn.resize(minSize);
+	crossPoints.assign(1, 0);
+	for (uint j = minSize - mCrossCount; j < minSize; j++) {
+		uniform_int_distribution<uint> dist(1, j);
+		uint point = dist(Random::generator);
+		if (drawn[point])
+			point = j;
+		drawn[point] = true;
+		crossPoints.push_back(point);
 	}
+	for (uint point : crossPoints)
+		drawn[point] = false;
+	sort(crossPoints.begin(), crossPoints.end());
 
-	ArrayGenomePtr<T> newGenome = make_shared<ArrayGenome<T>>();
+	// The child has the length of the parent giving the last segment
+	uint lastParent = mCrossCount & 1;
+	ArrayGenomePtr<T> newGenome = genomes[lastParent]->Clone();
 	vector<T>& newGenes = newGenome->GetGenes();
-	uint parent = 0;
-	for (uint i = 0; i < mCrossCount; i++) {
-		newGenes.insert(newGenes.end(),
-				(*genomes[parent]).begin() + crossPoints[i],
-				(*genomes[parent]).begin() + crossPoints[i + 1]);
-
-		parent ^= 1;
-	}
-	newGenes.insert(newGenes.end(),
-			(*genomes[parent]).begin() + crossPoints[mCrossCount],
-			(*genomes[parent]).end());
+	vector<T>& otherGenes = genomes[lastParent ^ 1]->GetGenes();
+	for (uint i = lastParent ^ 1; i < mCrossCount; i += 2)
+		CopyRange(newGenes, otherGenes, crossPoints[i], crossPoints[i + 1]);
 
 	return newGenome;
 }
 
+template<class T>
+void NPointCrossover<T>::CopyRange(vector<T>& pGenes, const vector<T>& pOther, size_t pBegin, size_t pEnd) {
+	copy(pOther.begin() + pBegin, pOther.begin() + pEnd, pGenes.begin() + pBegin);
+}
+
+#if !defined(DOXYGEN_IGNORE) && defined(EA_BIT_WORDS)
+template<>
+inline void NPointCrossover<bool>::CopyRange(vector<bool>& pGenes, const vector<bool>& pOther, size_t pBegin,
+		size_t pEnd) {
+	BitWords::Copy(pGenes, pOther, pBegin, pEnd);
+}
+#endif
+
 /**
  * Implementation of **N-point crossover** operator for ArrayGenome with specified number of split points.
  * This Recombinator is only applicable on ArrayGenome of the same type of genes T.
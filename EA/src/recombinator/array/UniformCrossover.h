@@ -8,6 +8,7 @@
 #pragma once
 
 #include "../../EA/Type/Array.h"
+#include "../../misc/BitWords.h"
 #include "../TypedRecombinator.h"
 
 namespace ea {
@@ -25,7 +26,10 @@ using namespace std;
  * @tparam T Type of genes.
  *
  * @method
- * Iterate through the array of genes, then apply probability test.
+ * The child starts as a copy of the longer parent. Then the genes are taken from the other parent
+ * by blocks of 64: a block draws one random 64-bit mask (see Random::Bits()) and each gene is selected by its bit
+ * without branching.
+ * For \ref BoolUniformCrossover, a block is one machine word and is blended with one bitwise operation.
  *
  * @time
  * O(N)
@@ -47,6 +51,9 @@ public:
 
 protected:
 	virtual ArrayGenomePtr<T> DoCombine(vector<ArrayGenomePtr<T>>& pParents) override;
+
+private:
+	void Inherit(vector<T>& pGenes, const vector<T>& pOther);
 };
 
 #ifndef DOXYGEN_IGNORE
@@ -57,23 +64,57 @@ EA_TYPEINFO_SPECIALIZED_DEFAULT(DoubleUniformCrossover)
 
 template<class T>
 ArrayGenomePtr<T> UniformCrossover<T>::DoCombine(vector<ArrayGenomePtr<T>>& pParents) {
-	vector<T>* genomes[2] = { &pParents[0]->GetGenes(),
-			&pParents[1]->GetGenes() };
+	uint longerParent = (pParents[0]->GetSize() > pParents[1]->GetSize()) ? 0 : 1;
+
+	ArrayGenomePtr<T> newGenome = pParents[longerParent]->Clone();
+	Inherit(newGenome->GetGenes(), pParents[longerParent ^ 1]->GetGenes());
+	return newGenome;
+}
 
-	uint longerParent = ((*genomes[0]).size() > (*genomes[1]).size()) ? 0 : 1;
-	uint minSize = (*genomes[longerParent ^ 1]).size();
+/**
+ * Replace each gene of the child by the gene of the other parent with a probability of 50%.
+ * @param pGenes The genes of the child (a copy of the longer parent).
+ * @param pOther The genes of the other parent.
+ */
+template<class T>
+void UniformCrossover<T>::Inherit(vector<T>& pGenes, const vector<T>& pOther) {
+	const size_t size = pOther.size();
 
-	ArrayGenomePtr<T> newGenome = make_shared<ArrayGenome<T>>();
-	vector<T>& newGenes = newGenome->GetGenes();
-	for (uint i = 0; i < minSize; i++) {
-		newGenes.push_back((*genomes[Random::generator() & 1])[i]);
+	// A bit selects the source array instead of the value, so the selection does not branch on random data
+	const T* sources[2] = { pGenes.data(), pOther.data() };
+	T* genes = pGenes.data();
+	for (size_t i = 0; i < size; i += 64) {
+		ullong mask = Random::Bits();
+		size_t end = min(size, i + 64);
+		for (size_t j = i; j < end; j++)
+			genes[j] = sources[(mask >> (j - i)) & 1][j];
 	}
-	newGenes.insert(newGenes.end(),
-			(*genomes[longerParent]).begin() + minSize,
-			(*genomes[longerParent]).end());
+}
 
-	return newGenome;
+#ifndef DOXYGEN_IGNORE
+template<>
+inline void UniformCrossover<bool>::Inherit(vector<bool>& pGenes, const vector<bool>& pOther) {
+	const size_t size = pOther.size();
+#ifdef EA_BIT_WORDS
+	if (size == 0)
+		return;
+
+	BitWords::Word* genes = BitWords::Get(pGenes);
+	const BitWords::Word* other = BitWords::Get(pOther);
+	size_t count = BitWords::Count(size);
+	for (size_t i = 0; i + 1 < count; i++)
+		genes[i] = BitWords::Blend(genes[i], other[i], BitWords::Word(Random::Bits()));
+	genes[count - 1] = BitWords::Blend(genes[count - 1], other[count - 1],
+			BitWords::Word(Random::Bits()) & BitWords::LastMask(size));
+#else
+	for (size_t i = 0; i < size; i += 64) {
+		ullong mask = Random::Bits();
+		for (size_t j = i; j < size && j < i + 64; j++, mask >>= 1)
+			if (mask & 1)
+				pGenes[j] = pOther[j];
+	}
+#endif
 }
+#endif
 
 } /* namespace ea */
-
@@ -20,10 +20,12 @@ namespace ea {
  * **Introduction to Evolutionary Computing**, 2nd Edition, 2015 by *A.E. Eiben* and *J.E. Smith*
  *
  * @method
- * Unknown
+ * The child is a copy of the first parent, then the positions outside the cycle starting at the first position
+ * take the genes of the second parent. The cycle is followed with an inverse index of the first parent instead of
+ * searching the genes. The index and the cycle flags are per-thread buffers reused between the calls.
  *
  * @time
- * Unknown
+ * O(N)
  *
  * @name{CycleCrossover}
  */
@@ -45,30 +47,29 @@ PermutationGenomePtr CycleCrossover::DoCombine(vector<PermutationGenomePtr>& pPa
 		throw invalid_argument("Two parents must have the same genome length.");
 
 	// make the child a copy of p1 (including genes of cycle1 from p1)
-	vector<uint>& p1Genome = (*genomes[0]), p2Genome = (*genomes[1]);
+	vector<uint>& p1Genome = (*genomes[0]), &p2Genome = (*genomes[1]);
 	PermutationGenomePtr newGenome = make_shared<PermutationGenome>(p1Genome);
 	vector<uint>& newGenes = newGenome->GetGenes();
 
-	uint currentIndex = 0;
-	vector<uint> cycle1;
-	cycle1.push_back(currentIndex);
+	// position of each gene in p1, and positions in cycle1
+	thread_local vector<uint> p1Positions;
+	thread_local vector<bool> cycle1;
+	p1Positions.resize(genomeLength);
+	cycle1.assign(genomeLength, false);
+	for (uint i = 0; i < genomeLength; i++)
+		p1Positions[p1Genome[i]] = i;
 
+	uint currentIndex = 0;
 	do {
+		cycle1[currentIndex] = true;
 		// where is this (p2's) gene in p1?
-		auto foundGene = find(p1Genome.begin(), p1Genome.end(), p2Genome[currentIndex]);
-
-		currentIndex = distance(p1Genome.begin(), foundGene);
-		cycle1.push_back(currentIndex);
+		currentIndex = p1Positions[p2Genome[currentIndex]];
 	} while (currentIndex != 0);
 
 	// copy genes of cycle2 from p2 to child
-	for (uint i = 0; i < genomeLength; i++) {
-		bool found = find(cycle1.begin(), cycle1.end(), i) != cycle1.end();
-		if (found)
-			continue;
-
-		newGenes[i] = p2Genome[i];
-	}
+	for (uint i = 0; i < genomeLength; i++)
+		if (!cycle1[i])
+			newGenes[i] = p2Genome[i];
 
 	return newGenome;
 }
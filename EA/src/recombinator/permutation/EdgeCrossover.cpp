@@ -21,11 +21,18 @@ namespace ea {
  * This is the implementation of the operator with the same name described in the book
  * **Introduction to Evolutionary Computing**, 2nd Edition, 2015 by *A.E. Eiben* and *J.E. Smith*
  *
+ * The child starts from a random element. The next element is a neighbour of the current one in the edge table:
+ * a common edge (shared by both parents) first, otherwise the neighbour with the shortest remaining list
+ * (ties are broken at random). If the current element has no neighbour left, a random remaining element is picked.
+ *
  * @method
- * Unknown
+ * The edge table is stored in a flat array indexed by the elements, where each row holds at most 4 neighbours
+ * (2 in each parent) with a flag for the common edges. When an element is placed, it is only removed from the rows
+ * of its own neighbours. The remaining elements are kept in an array with their positions, so a random remaining
+ * element is picked and removed in constant time. The table is a per-thread buffer reused between the calls.
  *
  * @time
- * Unknown
+ * O(N)
  *
  * @name{EdgeCrossover}
  */
@@ -37,126 +44,129 @@ EdgeCrossover::~EdgeCrossover() {
 }
 
 #ifndef DOXYGEN_IGNORE
-using TableType = unordered_map<uint, unordered_map<uint, bool>>;
+class EdgeTable {
+public:
+	void Build(const vector<uint>& pGenes1, const vector<uint>& pGenes2) {
+		uint size = pGenes1.size();
+		mRows.assign(size, Row());
+		mRemaining.resize(size);
+		mPositions.resize(size);
+		iota(mRemaining.begin(), mRemaining.end(), 0);
+		iota(mPositions.begin(), mPositions.end(), 0);
+
+		for (auto genes : { &pGenes1, &pGenes2 })
+			for (uint i = 0; i < size; i++) {
+				uint next = (*genes)[i + 1 < size ? i + 1 : 0];
+				AddEdge((*genes)[i], next);
+				AddEdge(next, (*genes)[i]);
+			}
+	}
+
+	uint PickRandom() const {
+		return mRemaining[uniform_int_distribution<uint>(0, mRemaining.size() - 1)(Random::generator)];
+	}
+
+	uint PickNext(uint pCurrent) {
+		Remove(pCurrent);
+		const Row& row = mRows[pCurrent];
+		if (row.size == 0)
+			return PickRandom();
+
+		// Common edges first
+		uint candidates[4], count = 0;
+		for (uint i = 0; i < row.size; i++)
+			if (row.common[i])
+				candidates[count++] = row.neighbours[i];
+
+		// Otherwise the neighbours with the shortest lists
+		if (count == 0) {
+			uint shortest = numeric_limits<uint>::max();
+			for (uint i = 0; i < row.size; i++) {
+				uint length = mRows[row.neighbours[i]].size;
+				if (length < shortest) {
+					shortest = length;
+					count = 0;
+				}
+				if (length == shortest)
+					candidates[count++] = row.neighbours[i];
+			}
+		}
+
+		// Ties are broken at random
+		if (count == 1)
+			return candidates[0];
+		return candidates[uniform_int_distribution<uint>(0, count - 1)(Random::generator)];
+	}
+
+private:
+	struct Row {
+		uint neighbours[4];
+		bool common[4];
+		uint size = 0;
+	};
+
+	vector<Row> mRows;
+	vector<uint> mRemaining;
+	vector<uint> mPositions;
+
+	void AddEdge(uint pElement, uint pNeighbour) {
+		Row& row = mRows[pElement];
+		for (uint i = 0; i < row.size; i++)
+			if (row.neighbours[i] == pNeighbour) {
+				row.common[i] = true;
+				return;
+			}
+		row.neighbours[row.size] = pNeighbour;
+		row.common[row.size++] = false;
+	}
 
-TableType ConstructEdgeTable(vector<uint>* genomes[2]);
+	// Remove the element from the rows of its neighbours and from the remaining elements
+	void Remove(uint pElement) {
+		const Row& row = mRows[pElement];
+		for (uint i = 0; i < row.size; i++) {
+			Row& other = mRows[row.neighbours[i]];
+			for (uint j = 0; j < other.size; j++)
+				if (other.neighbours[j] == pElement) {
+					other.size--;
+					other.neighbours[j] = other.neighbours[other.size];
+					other.common[j] = other.common[other.size];
+					break;
+				}
+		}
 
-template<class T>
-int PickRandomElement(unordered_map<uint, T> & map);
-void RemoveAllReferences(uint element, TableType & edgeTable);
-int PickNextElement(uint currentElement, TableType & edgeTable);
+		uint position = mPositions[pElement], last = mRemaining.back();
+		mRemaining[position] = last;
+		mPositions[last] = position;
+		mRemaining.pop_back();
+	}
+};
 #endif
 
 /**
  * Edge-3 Crossover
  */
 PermutationGenomePtr EdgeCrossover::DoCombine(vector<PermutationGenomePtr>& pParents) {
-	vector<uint>* genomes[2] = { &pParents[0]->GetGenes(),
-			&pParents[1]->GetGenes() };
+	vector<uint>& p1Genome = pParents[0]->GetGenes(), &p2Genome = pParents[1]->GetGenes();
 
-	uint genomeLength = (*genomes[0]).size();
+	uint genomeLength = p1Genome.size();
 	if (genomeLength < 2)
 		throw invalid_argument("Genome length must be greater than 1 for PermutationGenome");
-	if ((*genomes[1]).size() != genomeLength)
+	if (p2Genome.size() != genomeLength)
 		throw invalid_argument("Two parents with different genome lengths!");
 
 	PermutationGenomePtr newGenome = make_shared<PermutationGenome>();
 	vector<uint>& newGenes = newGenome->GetGenes();
+	newGenes.resize(genomeLength);
 
-	TableType edgeTable = ConstructEdgeTable(genomes);
-
-	uint element = PickRandomElement(edgeTable);
-	newGenes.push_back(element);
+	thread_local EdgeTable edgeTable;
+	edgeTable.Build(p1Genome, p2Genome);
 
-	for (uint i = 1; i < genomeLength; i++) {
-		RemoveAllReferences(element, edgeTable);
-		element = PickNextElement(element, edgeTable);
-		newGenes.push_back(element);
-	}
+	uint element = edgeTable.PickRandom();
+	newGenes[0] = element;
+	for (uint i = 1; i < genomeLength; i++)
+		newGenes[i] = element = edgeTable.PickNext(element);
 
 	return newGenome;
 }
 
-TableType ConstructEdgeTable(vector<uint>* genomes[2]) {
-
-	TableType edgeTable;
-	for (uint i = 0; i < 2; i++) {
-		auto first = (*genomes[i]).begin();
-		auto last = (*genomes[i]).end() - 1;
-
-		for (auto element = first; element != last + 1; element++) {
-			unordered_map<uint, bool> *row = &edgeTable[*element];
-
-			auto neighbour1 = element + 1;
-			auto neighbour2 = element - 1;
-
-			if (element == first) {
-				neighbour1 = first + 1;
-				neighbour2 = last;
-			} else if (element == last) {
-				neighbour1 = last - 1;
-				neighbour2 = first;
-			}
-
-			bool found = row->find(*neighbour1) != row->end();
-			(*row)[*neighbour1] = found;
-
-			found = row->find(*neighbour2) != row->end();
-			(*row)[*neighbour2] = found;
-		}
-	}
-	return edgeTable;
-}
-
-template<class T>
-int PickRandomElement(unordered_map<uint, T> & map) {
-	// random generator
-	uniform_int_distribution<uint> dist(0, map.size() - 1);
-
-	// get random element
-	auto it = map.begin();
-	advance(it, dist(Random::generator));
-
-	return it->first;	// important! only pick, no removal (make it reusable)
-}
-
-void RemoveAllReferences(uint element, TableType & edgeTable) {
-	for (auto it = edgeTable.begin(); it != edgeTable.end(); it++) {
-		if (it->first == element)
-			continue;
-
-		it->second.erase(element);
-	}
-}
-
-int PickNextElement(uint currentElement, TableType & edgeTable) {
-	// extract the current row
-	unordered_map<uint, bool> row = edgeTable[currentElement];
-	edgeTable.erase(currentElement);
-
-	// pick another row if the current row is empty
-	if (row.size() == 0) {
-		return PickRandomElement(edgeTable);
-	}
-
-	// find common edge
-	for (auto it = row.begin(); it != row.end(); it++)
-		if (it->second)
-			return it->first;
-
-	// find element that has shortest list
-	// start with a random element in the row
-	uint newElement = PickRandomElement(row);
-	uint shortest = edgeTable[newElement].size();
-
-	for (auto it = row.begin(); it != row.end(); it++) {
-		uint temp = edgeTable[it->first].size();
-		if (temp < shortest) {
-			shortest = temp;
-			newElement = it->first;
-		}
-	}
-	return newElement;
-}
-
 } /* namespace ea */
@@ -20,10 +20,13 @@ namespace ea {
  * **Introduction to Evolutionary Computing**, 2nd Edition, 2015 by *A.E. Eiben* and *J.E. Smith*
  *
  * @method
- * Unknown
+ * The segment of the first parent is copied to the child. Each gene of the segment of the second parent which
+ * is not copied yet follows the mapping between the parents until it reaches a free position, then the remaining
+ * positions take the genes of the second parent. The positions of the genes in the second parent are looked up in
+ * an inverse index instead of being searched. The index and the flags are per-thread buffers reused between the calls.
  *
  * @time
- * Unknown
+ * O(N)
  *
  * @name{PartiallyMappedCrossover}
  */
@@ -65,71 +68,42 @@ PermutationGenomePtr PartiallyMappedCrossover::DoCombine(vector<PermutationGenom
 	PermutationGenomePtr newGenome = make_shared<PermutationGenome>(p1Genome);
 	vector<uint>& newGenes = newGenome->GetGenes();
 
-	// keep track of vacancies in child's genome (outside the "segment")
-	vector<uint> vacancies;
-	for (uint i = 0; i < lowerIndex; i++)
-		vacancies.push_back(i);
-	for (uint i = upperIndex + 1; i < genomeLength; i++)
-		vacancies.push_back(i);
-
-	vector<uint>::iterator p1First = p1Genome.begin() + lowerIndex;
-	vector<uint>::iterator p1Last = p1Genome.begin() + upperIndex + 1;
-
-	vector<uint>::iterator p2First = p2Genome.begin() + lowerIndex;
-	vector<uint>::iterator p2Last = p2Genome.begin() + upperIndex + 1;
-
-	// copy genes in "segment" of p2 into child (only if they are not there already)
-	vector<uint>::iterator p2Gene;
-	for (p2Gene = p2First; p2Gene != p2Last; p2Gene++) {
-
-		// does this gene in p2 also exist in copied segment?
-		vector<uint>::iterator foundGene = find(p1First, p1Last, *p2Gene);
-		bool found = foundGene != p1Last;
-
-		// if not then
-		if (!found) {
-			uint tempIndex = distance(p2Genome.begin(), p2Gene);	// index of this gene in p2
-
-			bool occupied = true;
-			while (occupied) {
-				uint tempGene = newGenes[tempIndex];	// gene in child of the same position
-
-				// where is this value in p2?
-				foundGene = find(p2Genome.begin(), p2Genome.end(), tempGene);
-				tempIndex = distance(p2Genome.begin(), foundGene);
-
-				// is tempIndex in child occupied?
-				occupied = find(vacancies.begin(), vacancies.end(), tempIndex)
-						== vacancies.end();
-			}
-
-			// assign new gene to child
-			newGenes[tempIndex] = *p2Gene;
-
-			vacancies.erase(remove(vacancies.begin(), vacancies.end(), tempIndex),
-					vacancies.end());
-		}
+	// position of each gene in p2, genes copied from the segment of p1, and occupied positions in child
+	thread_local vector<uint> p2Positions;
+	thread_local vector<bool> copied, occupied;
+	p2Positions.resize(genomeLength);
+	copied.assign(genomeLength, false);
+	occupied.assign(genomeLength, false);
+
+	for (uint i = 0; i < genomeLength; i++)
+		p2Positions[p2Genome[i]] = i;
+	for (uint i = lowerIndex; i <= upperIndex; i++) {
+		copied[p1Genome[i]] = true;
+		occupied[i] = true;
 	}
 
-	// copy the rest from p2 to child
-	for (uint i = 0; i < genomeLength; i++) {
-
-		// skip over the "segment" in p2
-		if (lowerIndex <= i && i <= upperIndex)
+	// copy genes in "segment" of p2 into child (only if they are not there already)
+	for (uint i = lowerIndex; i <= upperIndex; i++) {
+		uint gene = p2Genome[i];
+		if (copied[gene])
 			continue;
 
-		uint newGene = p2Genome[i];
-
-		// ignore genes in p2 that already exist in copied segment
-		bool found = find(p1First, p1Last, newGene) != p1Last;
-		if (found)
-			continue;
+		// follow the mapping until a free position is found
+		uint tempIndex = i;
+		do
+			tempIndex = p2Positions[newGenes[tempIndex]];
+		while (occupied[tempIndex]);
 
 		// assign new gene to child
-		newGenes[vacancies[0]] = newGene;
-		vacancies.erase(vacancies.begin());
+		newGenes[tempIndex] = gene;
+		occupied[tempIndex] = true;
 	}
 
+	// the rest of p2 is copied at the same positions
+	for (uint i = 0; i < genomeLength; i++)
+		if (!occupied[i])
+			newGenes[i] = p2Genome[i];
+
 	return newGenome;
 }
 
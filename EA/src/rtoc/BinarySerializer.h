@@ -10,6 +10,7 @@
 #include "../EA/Type/Utility.h"
 #include "NameService.h"
 #include "StorableDef.h"
+#include "TypeDictionary.h"
 #include <algorithm>
 
 namespace ea {
@@ -67,8 +68,13 @@ public:
 
 		StorablePtr storable = static_pointer_cast<Storable>(pPtr);
 
-		if (!is_final<T>::value)
-			BinarySerializer<string>::Write(pStream, string(storable->GetTypeName()));
+		if (!is_final<T>::value) {
+			TypeDictionary* dict = TypeDictionary::Get(pStream);
+			if (dict)
+				dict->WriteType(pStream, *storable);
+			else
+				BinarySerializer<string>::Write(pStream, string(storable->GetTypeName()));
+		}
 
 		storable->Serialize(pStream);
 	}
@@ -78,17 +84,18 @@ public:
 		static_assert(is_base_of<Storable, T>::value,
 				"BinarySerializer<Ptr>::Read<T>(): Request object type must be derived from Storable.");
 
-		string className = BinarySerializer<string>::Read(pStream);
+		TypeDictionary* dict = TypeDictionary::Get(pStream);
+		const TypeInfo& info = dict ? dict->ReadType(pStream) : NameService::Get(BinarySerializer<string>::Read(pStream));
 
-		StorablePtr storable = dynamic_pointer_cast<Storable>(NameService::Get(className).Construct({ }));
-		if (!storable)
+		ConstructiblePtr constructed = info.ConstructDefault();
+		Ptr<T> obj = dynamic_pointer_cast<T>(constructed);
+		if (!obj) {
+			if (!dynamic_pointer_cast<Storable>(constructed))
+				throw EA_EXCEPTION(RTOCException, BINARY_READ_BAD_CAST,
+						"BinarySerializer<Ptr>::Read<T>(): Class \"" + info.GetTypeName() + "\" is not Storable.");
 			throw EA_EXCEPTION(RTOCException, BINARY_READ_BAD_CAST,
-					"BinarySerializer<Ptr>::Read<T>(): Class \"" + className + "\" is not Storable.");
-
-		Ptr<T> obj = dynamic_pointer_cast<T>(storable);
-		if (!obj)
-		  throw EA_EXCEPTION(RTOCException, BINARY_READ_BAD_CAST,
-			  "BinarySerializer<Ptr>::Read<T>(): Cannot cast the object into T.");
+				"BinarySerializer<Ptr>::Read<T>(): Cannot cast the object into T.");
+		}
 
 		obj->Deserialize(pStream);
 		return obj;
@@ -105,21 +112,38 @@ public:
 	}
 };
 
+template<class T>
+struct IsBulkSerializable : integral_constant<bool,
+		(is_arithmetic<T>::value || is_enum<T>::value) && !is_same<T, bool>::value> { };
+
 template<class T>
 class BinarySerializer<vector<T>> {
-public:
-	inline static void Write(ostream& pStream, const vector<T>& pData) {
-		BinarySerializer<uint>::Write(pStream, pData.size());
+private:
+	inline static void WriteElements(ostream& pStream, const vector<T>& pData, true_type) {
+		pStream.write(reinterpret_cast<const char*>(pData.data()), pData.size() * sizeof(T));
+	}
+	inline static void WriteElements(ostream& pStream, const vector<T>& pData, false_type) {
 		for (const T& elem : pData) {
 			BinarySerializer<T>::Write(pStream, elem);
 		}
 	}
+	inline static void ReadElements(istream& pStream, vector<T>& pData, true_type) {
+		pStream.read(reinterpret_cast<char*>(pData.data()), pData.size() * sizeof(T));
+	}
+	inline static void ReadElements(istream& pStream, vector<T>& pData, false_type) {
+		for (auto it = pData.begin(); it != pData.end(); it++)
+			*it = BinarySerializer<T>::Read(pStream);
+	}
+
+public:
+	inline static void Write(ostream& pStream, const vector<T>& pData) {
+		BinarySerializer<uint>::Write(pStream, pData.size());
+		WriteElements(pStream, pData, IsBulkSerializable<T>());
+	}
 	inline static void Read(istream& pStream, vector<T>& pData) {
 		uint size = BinarySerializer<uint>::Read(pStream);
 		pData.resize(size);
-
-		for (auto it = pData.begin(); it != pData.end(); it++)
-			*it = BinarySerializer<T>::Read(pStream);
+		ReadElements(pStream, pData, IsBulkSerializable<T>());
 	}
 	inline static const vector<T> Read(istream& pStream) {
 		vector<T> data;
@@ -77,6 +77,7 @@ NameService::InitStruct::InitStruct() {
 	ADD(OrganismPool);
 	ADD(GenomePool);
 	ADD(MetaPool);
+	ADD(CheckpointPool);
 
 	// Initializer
 	ADD_PACK(RandomArrayInitializer);
@@ -107,6 +108,20 @@ NameService::InitStruct::InitStruct() {
 	ADD(UniformSelection);
 	ADD(TournamentSelection);
 
+	// Evaluator
+	ADD(NullEvaluator);
+
+	// Benchmark problems
+	ADD(SphereFunction);
+	ADD(EllipsoidFunction);
+	ADD(RastriginFunction);
+	ADD(RosenbrockFunction);
+	ADD(AckleyFunction);
+	ADD(OneMaxFunction);
+	ADD(LeadingOnesFunction);
+	ADD(NKLandscapeFunction);
+	ADD(TSPFunction);
+
 	// Hooks
 	ADD(StandardOutputHook);
 	ADD(FitnessTerminationHook);
@@ -115,6 +130,9 @@ NameService::InitStruct::InitStruct() {
 	ADD(BackupHook);
 	ADD(RealTimeInfoHook);
 	ADD(FitnessReportHook);
+	ADD(TraceHook);
+	ADD(BenchmarkHook);
+	ADD(MemoryReportHook);
 
 	// Genome
 	ADD(BoolArrayGenome);
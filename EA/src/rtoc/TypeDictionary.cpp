@@ -0,0 +1,180 @@
+/*
+ * TypeDictionary.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../pch.h"
+#include "TypeDictionary.h"
+#include "BinarySerializer.h"
+
+namespace ea {
+
+/**
+ * @class TypeDictionary
+ * Per-stream dictionary of class names used by BinarySerializer.
+ * By default, BinarySerializer writes the full class name of every non-final Storable object
+ * in front of its data, so a stream of many objects of the same type contains the same string many times.
+ * When a TypeDictionary is attached to a stream, each class name is only written once (at its first occurrence)
+ * together with a small integer ID. Later objects of the same type only refer to that ID.
+ * When reading, the dictionary also caches the resolved TypeInfo, so NameService is only queried once per type.
+ *
+ * A TypeDictionary is attached to a stream when it is constructed and detached when it is destroyed.
+ * The same kind of dictionary must be attached when reading a stream written with a dictionary:
+ *
+ * @code
+ * ofstream ofs("file", ios::binary);
+ * TypeDictionary dict(ofs);
+ * BinarySerializer<PopulationPtr>::Write(ofs, population);
+ * @endcode
+ *
+ * Streams without a dictionary keep the original format (used in cluster transfers and old back-up files).
+ *
+ * A dictionary can also be non-inline: class names are never written into the stream, the writer
+ * collects them (see GetTypeNames()) and stores them elsewhere, and the reader is created with the resolved types.
+ * This allows objects to be decoded independently of each other (used by indexed back-ups).
+ *
+ * @see BinarySerializer
+ * @see BackupHook
+ */
+
+const int TypeDictionary::sIndex = ios_base::xalloc();
+
+#ifndef DOXYGEN_IGNORE
+static void WriteId(ostream& pStream, uint pId) {
+	char buffer[5];
+	uint length = 0;
+	do {
+		buffer[length] = pId & 0x7F;
+		pId >>= 7;
+		if (pId)
+			buffer[length] |= 0x80;
+		length++;
+	} while (pId);
+	pStream.write(buffer, length);
+}
+
+static uint ReadId(istream& pStream) {
+	uint id = 0;
+	for (uint shift = 0; shift < 35; shift += 7) {
+		int byte = pStream.get();
+		if (byte == EOF)
+			break;
+		id |= uint(byte & 0x7F) << shift;
+		if (!(byte & 0x80))
+			return id;
+	}
+	throw EA_EXCEPTION(RTOCException, BINARY_READ_BAD_TYPE_ID,
+			"TypeDictionary::ReadType(): Type ID is corrupted.");
+}
+#endif
+
+/**
+ * Create an empty TypeDictionary and attach it to the given stream.
+ * Any BinarySerializer invoked on this stream will use the dictionary until it is destroyed.
+ * @param pStream The stream to attach the dictionary to.
+ * @param pInline If false, class names are not written into the stream (see GetTypeNames()).
+ */
+TypeDictionary::TypeDictionary(ios_base& pStream, bool pInline) :
+		mStream(pStream), mInline(pInline), mIds(), mNames(), mTypes() {
+	mStream.pword(sIndex) = this;
+}
+
+/**
+ * Create a non-inline TypeDictionary with known types and attach it to the given stream.
+ * This is used to read a stream written by a non-inline dictionary.
+ * @param pStream The stream to attach the dictionary to.
+ * @param pTypes The types in the order of their IDs.
+ */
+TypeDictionary::TypeDictionary(ios_base& pStream, const vector<const TypeInfo*>& pTypes) :
+		mStream(pStream), mInline(false), mIds(), mNames(), mTypes(pTypes) {
+	mStream.pword(sIndex) = this;
+}
+
+/**
+ * Detach the dictionary from the stream.
+ */
+TypeDictionary::~TypeDictionary() {
+	if (mStream.pword(sIndex) == this)
+		mStream.pword(sIndex) = nullptr;
+}
+
+/**
+ * Write the type of the given object to the stream.
+ * The first time a type is written, its ID is followed by the class name. Afterwards, only the ID is written.
+ * @param pStream The output stream (must be the stream this dictionary is attached to).
+ * @param pObj The object whose type will be written.
+ */
+void TypeDictionary::WriteType(ostream& pStream, Storable& pObj) {
+	type_index type(typeid(pObj));
+
+	auto entry = mIds.find(type);
+	if (entry != mIds.end()) {
+		WriteId(pStream, entry->second);
+		return;
+	}
+
+	uint id = mIds.size();
+	string name = pObj.GetTypeName();
+	mIds.emplace(type, id);
+	mNames.push_back(name);
+	WriteId(pStream, id);
+	if (mInline)
+		BinarySerializer<string>::Write(pStream, name);
+}
+
+/**
+ * Read a type written by WriteType() from the stream.
+ * New class names are resolved by NameService and cached for later IDs.
+ * @param pStream The input stream (must be the stream this dictionary is attached to).
+ * @return The TypeInfo of the next object in the stream.
+ */
+const TypeInfo& TypeDictionary::ReadType(istream& pStream) {
+	uint id = ReadId(pStream);
+	if (id < mTypes.size())
+		return *mTypes[id];
+
+	if (id != mTypes.size() || !mInline)
+		throw EA_EXCEPTION(RTOCException, BINARY_READ_BAD_TYPE_ID,
+				"TypeDictionary::ReadType(): Type ID " + to_string(id) + " is not defined.");
+
+	const TypeInfo& info = NameService::Get(BinarySerializer<string>::Read(pStream));
+	mTypes.push_back(&info);
+	return info;
+}
+
+/**
+ * Get the number of types registered in this dictionary.
+ * @return The number of distinct types written or read so far.
+ */
+uint TypeDictionary::GetSize() const {
+	return max<uint>(mIds.size(), mTypes.size());
+}
+
+/**
+ * Get the class names written so far, in the order of their IDs.
+ * @return The list of class names.
+ */
+const vector<string>& TypeDictionary::GetTypeNames() const {
+	return mNames;
+}
+
+/**
+ * Get the types read so far (or given in the constructor), in the order of their IDs.
+ * @return The list of types.
+ */
+const vector<const TypeInfo*>& TypeDictionary::GetTypes() const {
+	return mTypes;
+}
+
+/**
+ * Get the dictionary attached to the given stream.
+ * @param pStream The stream to query.
+ * @return The attached dictionary, or nullptr if there is none.
+ */
+TypeDictionary* TypeDictionary::Get(ios_base& pStream) {
+	return static_cast<TypeDictionary*>(pStream.pword(sIndex));
+}
+
+} /* namespace ea */
@@ -0,0 +1,47 @@
+/*
+ * TypeDictionary.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../EA/Type/Utility.h"
+#include "TypeInfo.h"
+#include <typeindex>
+#include <ios>
+
+namespace ea {
+
+using namespace std;
+
+class TypeDictionary final {
+public:
+	TypeDictionary(ios_base& pStream, bool pInline = true);
+	TypeDictionary(ios_base& pStream, const vector<const TypeInfo*>& pTypes);
+	~TypeDictionary();
+
+	TypeDictionary(const TypeDictionary&) = delete;
+	TypeDictionary& operator=(const TypeDictionary&) = delete;
+
+	void WriteType(ostream& pStream, Storable& pObj);
+	const TypeInfo& ReadType(istream& pStream);
+
+	uint GetSize() const;
+	const vector<string>& GetTypeNames() const;
+	const vector<const TypeInfo*>& GetTypes() const;
+
+	static TypeDictionary* Get(ios_base& pStream);
+
+private:
+	ios_base& mStream;
+	bool mInline;
+	HashMap<type_index, uint> mIds;
+	vector<string> mNames;
+	vector<const TypeInfo*> mTypes;
+
+	static const int sIndex;
+};
+
+} /* namespace ea */
@@ -62,7 +62,7 @@ namespace ea {
  * @param pTypeName The class name.
  */
 TypeInfo::TypeInfo(string pTypeName) :
-		mTypeName(pTypeName), mSetterMap(), mConstructor() {
+		mTypeName(pTypeName), mSetterMap(), mConstructor(), mFactory(nullptr) {
 }
 
 TypeInfo::~TypeInfo() {
@@ -108,10 +108,16 @@ void TypeInfo::Add(string pName, UnifiedSetter pSetter) {
  * because they don't bind to a determined field (they only bind to the parameter of the constructor).
  * @tparam T The type of this class.
  * @tparam Args The type of parameters with the same order with the real constructor.
+ * If the constructor has no parameter, it is also used as the default factory (see ConstructDefault()).
  * @param pNames The name of the parameters with the same order.
  * @return Pointer to this TypeInfo for cascade invocation.
  */
 
+/**
+ * @typedef TypeInfo::DefaultFactory
+ * Plain function pointer which default-constructs an object of the type.
+ */
+
 void TypeInfo::SetConstructor(ConstructorCaller pCaller) {
 	mConstructor = pCaller;
 }
@@ -140,6 +146,29 @@ ConstructiblePtr TypeInfo::Construct(const UnifiedMap& pData) const {
 	return obj;
 }
 
+/**
+ * Construct a Constructible object of this type without any parameter.
+ * This is the fast path used to create objects which are filled right after (e.g. by BinarySerializer or Pool::Clone()).
+ * If the main constructor has no parameter, the object is created directly through the default factory,
+ * without building the data map and calling the generic constructor. Otherwise, this is the same as Construct().
+ * @return The constructed object.
+ */
+ConstructiblePtr TypeInfo::ConstructDefault() const {
+	if (mFactory)
+		return mFactory();
+	return Construct();
+}
+
+/**
+ * Get the default factory of this type.
+ * The factory is only available if the main constructor has no parameter.
+ * Callers which create many objects of the same type can keep the pointer and call it directly.
+ * @return The default factory, or nullptr if the type has no default constructor.
+ */
+TypeInfo::DefaultFactory TypeInfo::GetDefaultFactory() const {
+	return mFactory;
+}
+
 /**
  * Set the value of an optional attribute of the given object.
  * This function will set the value of the field corresponding to the given name.
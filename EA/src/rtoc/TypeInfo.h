@@ -20,6 +20,7 @@ public:
 	virtual ~TypeInfo();
 
 	string GetTypeName() const;
+	using DefaultFactory = ConstructiblePtr (*)();
 	using ConstructiblePtrRef = const ConstructiblePtr&;
 	using UnifiedDataRef = const UnifiedData&;
 	using UnifiedMap = HashMap<string, UnifiedData>;
@@ -42,6 +43,20 @@ private:
 		return uniMap.at(pName).Get<T>();
 	}
 
+	template<class T>
+	static ConstructiblePtr DefaultConstruct() {
+		return make_shared<T>();
+	}
+
+	template<class T>
+	inline void SetDefaultFactory(true_type) {
+		mFactory = &DefaultConstruct<T>;
+	}
+	template<class T>
+	inline void SetDefaultFactory(false_type) {
+		mFactory = nullptr;
+	}
+
 public:
 	template<class MemberT, class ClassT>
 	inline TypeInfo* Add(string pName, MemberT ClassT::*pMember) {
@@ -80,10 +95,13 @@ public:
 								"Constructor of " + name + ": Missing attributes or elements.");
 					}
 				}));
+		SetDefaultFactory<T>(integral_constant<bool, sizeof...(Args) == 0>());
 		return this;
 	}
 
 	ConstructiblePtr Construct(const UnifiedMap& pData = { }) const;
+	ConstructiblePtr ConstructDefault() const;
+	DefaultFactory GetDefaultFactory() const;
 	bool Set(string pName, ConstructiblePtrRef pObj, UnifiedDataRef pData) const;
 
 private:
@@ -93,6 +111,7 @@ private:
 
 	UnifiedSetterMap mSetterMap;
 	ConstructorCaller mConstructor;
+	DefaultFactory mFactory;
 };
 
 } /* namespace ea */
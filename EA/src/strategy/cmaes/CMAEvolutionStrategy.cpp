@@ -143,11 +143,13 @@ void CMAEvolutionStrategy::Begin() {
 }
 
 void CMAEvolutionStrategy::Loop() {
+	static const Phase SPAWN("S"), EVALUATION("E"), UPDATE("U"), DECOMPOSITION("D");
+
 	mState = *GetPool(2)->To<CMAStatePool>();
 
 	// Spawning
 	GenomePoolPtr spawnPool = make_shared<GenomePool>(mLambda);
-	Execute("S", function<void(void)>([&] () {
+	Execute(SPAWN, function<void(void)>([&] () {
 		MultiThreading::For(0, mLambda, [&] (int i) {
 			VectorXd x = mean + sigma * B * (D.array() * RandomVector().array()).matrix();
 			DoubleArrayGenomePtr genome = make_shared<DoubleArrayGenome>();
@@ -157,7 +159,7 @@ void CMAEvolutionStrategy::Loop() {
 	}));
 
 	// Evaluation
-	OrganismPoolPtr evaluatedPool = Execute("E", evaluator, spawnPool);
+	OrganismPoolPtr evaluatedPool = Execute(EVALUATION, evaluator, spawnPool);
 	evaluatedPool->Sort();
 
 	// Extract
@@ -170,7 +172,7 @@ void CMAEvolutionStrategy::Loop() {
 
 	// Update
 	MatrixXd C;
-	Execute("U", function<void(void)>([&] () {
+	Execute(UPDATE, function<void(void)>([&] () {
 		VectorXd meanOld = mean;
 		mean = X * weights;
 
@@ -190,13 +192,23 @@ void CMAEvolutionStrategy::Loop() {
 		sigma *= exp((cs/damps)*(ps.norm()/chiN - 1));
 	}));
 
-	Execute("D", function<void(void)>(bind(&CMAEvolutionStrategy::Decompose, this, ref(C))));
+	Execute(DECOMPOSITION, function<void(void)>(bind(&CMAEvolutionStrategy::Decompose, this, ref(C))));
 
 	// Finalize
 	SetPool(0, evaluatedPool);
 	SetPool(2, make_shared<CMAStatePool>(mState));
 }
 
+/**
+ * Get the Checkpointable hooks and operators of this Strategy.
+ * @return The list of Checkpointable components.
+ */
+vector<CheckpointablePtr> CMAEvolutionStrategy::GetCheckpointables() const {
+	auto list = Strategy::GetCheckpointables();
+	CollectCheckpointables(list, evaluator);
+	return list;
+}
+
 vector<string> CMAEvolutionStrategy::GetTimeRecordOrder() const {
 	return { "S", "E", "U", "D" };
 }
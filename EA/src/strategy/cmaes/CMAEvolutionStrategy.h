@@ -32,14 +32,14 @@ public:
 	Operator<IndividualEvaluator> evaluator;
 
 	virtual bool IsReady() override;
+	virtual vector<CheckpointablePtr> GetCheckpointables() const override;
+	virtual vector<string> GetTimeRecordOrder() const override;
 
 protected:
 	virtual void Setup() override;
 	virtual void Begin() override;
 	virtual void Loop() override;
 
-	virtual vector<string> GetTimeRecordOrder() const override;
-
 private:
 	uint mLambda;
 	uint mMu;
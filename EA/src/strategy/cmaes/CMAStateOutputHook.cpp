@@ -40,6 +40,9 @@ CMAStateOutputHook::~CMAStateOutputHook() {
 }
 
 void CMAStateOutputHook::DoGenerational() {
+	if (!Log::IsEnabled(Log::INFO))
+		return;
+
 	CMAStatePoolPtr cmapool = GetPopulation()->GetPool(2)->To<CMAStatePool>();
 
 	LogStream info(Log::INFO);
@@ -15,6 +15,14 @@ using namespace Eigen;
 CMAStatePool::~CMAStatePool() {
 }
 
+/**
+ * Create a copy of this CMAStatePool.
+ * @return The copy of this CMAStatePool.
+ */
+PoolPtr CMAStatePool::Clone() const {
+	return make_shared<CMAStatePool>(*this);
+}
+
 #ifndef DOXYGEN_IGNORE
 template<class Scalar, int Rows, int Cols>
 class BinarySerializer<Matrix<Scalar, Rows, Cols>> {
@@ -37,6 +37,8 @@ public:
 
 	virtual ~CMAStatePool();
 
+	virtual PoolPtr Clone() const override;
+
 	uint N;			///< The number of dimensions.
 	VectorXd mean;	///< The current mean, a vector with length #N.
 	VectorXd ps;	///< The isotropic evolution path, a vector with length #N.
@@ -118,13 +118,15 @@ void EvolutionStrategy::Begin() {
 }
 
 void EvolutionStrategy::Loop() {
+	static const Phase SPAWN("S"), MUTATION("M"), EVALUATION("E"), FILTER("F");
+
 	OrganismPoolPtr mainPool = GetPopulation()->GetOrganismPool(0);
 
-	vector<GenomePoolPtr> spawnPools = ExecuteInParallel("S", recombinators, mainPool);
+	vector<GenomePoolPtr> spawnPools = ExecuteInParallel(SPAWN, recombinators, mainPool);
 
-	GenomePoolPtr mutatedPool = ExecuteInSeries("M", mutators, GenomePool::Join(spawnPools));
+	GenomePoolPtr mutatedPool = ExecuteInSeries(MUTATION, mutators, GenomePool::Join(spawnPools));
 
-	OrganismPoolPtr evaluatedPool = Execute("E", evaluator, mutatedPool);
+	OrganismPoolPtr evaluatedPool = Execute(EVALUATION, evaluator, mutatedPool);
 
 	OrganismPoolPtr prefilterPool;
 	if (mSelectionMode == PLUS)
@@ -132,7 +134,7 @@ void EvolutionStrategy::Loop() {
 	else
 		prefilterPool = evaluatedPool;
 
-	OrganismPoolPtr filteredPool = Execute("F", survivalSelector, prefilterPool, mPopSize);
+	OrganismPoolPtr filteredPool = Execute(FILTER, survivalSelector, prefilterPool, mPopSize);
 
 	GetPopulation()->SetPool(0, filteredPool);
 	GetPopulation()->SetPool(1, mutatedPool);
@@ -163,6 +165,20 @@ EvolutionStrategy::SelectionMode EvolutionStrategy::GetSelectionMode() const {
 	return mSelectionMode;
 }
 
+/**
+ * Get the Checkpointable hooks and operators of this Strategy.
+ * @return The list of Checkpointable components.
+ */
+vector<CheckpointablePtr> EvolutionStrategy::GetCheckpointables() const {
+	auto list = Strategy::GetCheckpointables();
+	CollectCheckpointables(list, initializer);
+	CollectCheckpointables(list, recombinators);
+	CollectCheckpointables(list, mutators);
+	CollectCheckpointables(list, evaluator);
+	CollectCheckpointables(list, survivalSelector);
+	return list;
+}
+
 vector<string> EvolutionStrategy::GetTimeRecordOrder() const {
 	return { "S", "M", "E", "F" };
 }
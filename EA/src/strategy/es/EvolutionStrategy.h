@@ -40,14 +40,14 @@ public:
 	SelectionMode GetSelectionMode() const;
 
 	virtual bool IsReady() override;
+	virtual vector<CheckpointablePtr> GetCheckpointables() const override;
+	virtual vector<string> GetTimeRecordOrder() const override;
 
 protected:
 	virtual void Setup() override;
 	virtual void Begin() override;
 	virtual void Loop() override;
 
-	virtual vector<string> GetTimeRecordOrder() const override;
-
 private:
 	uint mPopSize;
 	SelectionMode mSelectionMode;
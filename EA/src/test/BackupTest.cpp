@@ -11,6 +11,7 @@
 
 #include "../EA.h"
 #include "core/PopulationFixture.h"
+#include "core/StrategyFixture.h"
 #include <boost/filesystem.hpp>
 
 namespace ea {
@@ -90,6 +91,137 @@ BOOST_FIXTURE_TEST_CASE(RestoreTest, PopulationFixture) {
 	remove_all("backup");
 }
 
+BOOST_AUTO_TEST_CASE(BackupCodecTest) {
+	PopulationPtr population = make_shared<Population>();
+	population->SetCounter(Population::GENERATION_COUNTER, 12);
+	population->SetCounter(Population::EVALUATION_COUNTER, 345);
+
+	for (string codec : { BackupCodec::NONE, BackupCodec::ZLIB }) {
+		stringstream ss;
+		BackupHook::WriteBackup(ss, population, codec);
+
+		PopulationPtr restored;
+		BOOST_REQUIRE_NO_THROW(restored = Restore::FromStream(ss));
+		BOOST_CHECK(restored->GetGeneration() == 12);
+		BOOST_CHECK(restored->GetEvaluation() == 345);
+	}
+
+	stringstream ss;
+	BOOST_CHECK_THROW(BackupHook::WriteBackup(ss, population, "unknown"), EAException);
+}
+
+BOOST_AUTO_TEST_CASE(BackupDeltaTest) {
+	PopulationPtr base = make_shared<Population>();
+	OrganismPoolPtr pool = make_shared<OrganismPool>();
+	for (uint i = 0; i < 10; i++) {
+		vector<double> genes(10, i);
+		pool->push_back(make_shared<Organism>(make_shared<DoubleArrayGenome>(genes), make_shared<ScalarFitness>(i)));
+	}
+	base->SetPool(0, pool);
+
+	PopulationPtr population = base->Snapshot();
+	population->IncreaseGeneration();
+	OrganismPoolPtr newPool = population->GetOrganismPool(0);
+	newPool->erase(newPool->begin());
+	vector<double> genes(10, 10);
+	newPool->push_back(make_shared<Organism>(make_shared<DoubleArrayGenome>(genes), make_shared<ScalarFitness>(10)));
+
+	stringstream full, delta;
+	BackupHook::WriteBackup(full, population);
+	BackupHook::WriteBackup(delta, population, BackupCodec::NONE, base);
+	BOOST_CHECK(delta.str().size() < full.str().size());
+
+	BOOST_CHECK_THROW(Restore::FromStream(delta), EAException);
+	delta.seekg(0);
+
+	PopulationPtr restored = Restore::FromStream(delta, [&](ullong pGeneration) {
+		BOOST_CHECK(pGeneration == base->GetGeneration());
+		return base;
+	});
+	BOOST_CHECK(restored->GetGeneration() == 1);
+	OrganismPoolPtr restoredPool = restored->GetOrganismPool(0);
+	BOOST_REQUIRE(restoredPool->size() == 10);
+	for (uint i = 0; i < 10; i++)
+		BOOST_CHECK(restoredPool->at(i)->GetFitnessValue() == i + 1);
+	BOOST_CHECK(restoredPool->at(0) == pool->at(1));
+}
+
+BOOST_AUTO_TEST_CASE(BackupIndexTest) {
+	PopulationPtr population = make_shared<Population>();
+	OrganismPoolPtr pool = make_shared<OrganismPool>();
+	for (uint i = 0; i < 100; i++) {
+		vector<double> genes(10, i);
+		pool->push_back(make_shared<Organism>(make_shared<DoubleArrayGenome>(genes), make_shared<ScalarFitness>(i % 7)));
+	}
+	population->SetPool(0, pool);
+	population->SetCounter(Population::GENERATION_COUNTER, 5);
+
+	stringstream ss;
+	BackupHook::WriteBackup(ss, population, BackupCodec::NONE, nullptr, true);
+	BOOST_CHECK_THROW(BackupHook::WriteBackup(ss, population, BackupCodec::ZLIB, nullptr, true), EAException);
+
+	PopulationPtr restored = Restore::FromStream(ss);
+	BOOST_CHECK(restored->GetGeneration() == 5);
+	BOOST_REQUIRE(restored->GetOrganismPool(0)->size() == 100);
+	BOOST_CHECK(restored->GetOrganismPool(0)->at(42)->GetFitnessValue() == 42 % 7);
+
+	ss.clear();
+	ss.seekg(0);
+	BackupReader reader(ss);
+	BOOST_CHECK(reader.GetGeneration() == 5);
+	BOOST_CHECK(reader.GetPoolSize(0) == 100);
+	OrganismPoolPtr top = reader.ReadTop(0, 3);
+	BOOST_REQUIRE(top->size() == 3);
+	for (auto& organism : *top)
+		BOOST_CHECK(organism->GetFitnessValue() == 6);
+}
+
+BOOST_AUTO_TEST_CASE(CheckpointTest) {
+	PopulationPtr population = make_shared<Population>();
+	Random::Seed(123);
+	Random::Rate();
+	CheckpointPoolPtr checkpoint = Checkpoint::Capture(nullptr);
+
+	stringstream full, indexed;
+	BackupHook::WriteBackup(full, population, BackupCodec::ZLIB, nullptr, false, checkpoint);
+	BackupHook::WriteBackup(indexed, population, BackupCodec::NONE, nullptr, true, checkpoint);
+	BOOST_CHECK(population->GetPools().empty());
+	vector<double> expected;
+	for (uint i = 0; i < 10; i++)
+		expected.push_back(Random::Rate());
+
+	for (stringstream* ss : { &full, &indexed }) {
+		Random::Seed(456);
+		PopulationPtr restored = Restore::FromStream(*ss);
+		BOOST_CHECK(restored->GetPools().empty());
+		BOOST_REQUIRE(Checkpoint::Reinstate(restored, nullptr));
+		for (uint i = 0; i < 10; i++)
+			BOOST_CHECK(Random::Rate() == expected[i]);
+	}
+
+	stringstream none;
+	BackupHook::WriteBackup(none, population);
+	BOOST_CHECK(!Checkpoint::Reinstate(Restore::FromStream(none), nullptr));
+}
+
+BOOST_FIXTURE_TEST_CASE(CheckpointHookTest, StrategyFixture) {
+	remove_all("backup");
+
+	// The checkpoint is written to the files, the evolving Population is left unchanged
+	auto strategy = CreateStrategy(5);
+	strategy->hooks.Create<BackupHook>("backup", 2);
+	PopulationPtr population = strategy->Evolve()->GetPopulation();
+	for (auto& pool : population->GetPools())
+		BOOST_CHECK(!dynamic_pointer_cast<CheckpointPool>(pool.second));
+
+	PopulationPtr restored = Restore::FromBackup("backup");
+	BOOST_CHECK(restored->GetGeneration() == population->GetGeneration());
+	BOOST_CHECK(restored->GetPools().size() == population->GetPools().size());
+	BOOST_CHECK(restored->GetCheckpoint());
+
+	remove_all("backup");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }// namespace test
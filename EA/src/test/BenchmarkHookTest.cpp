@@ -0,0 +1,80 @@
+/*
+ * BenchmarkHookTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#define BOOST_TEST_DYN_LINK
+#include "../pch.h"
+#include <boost/test/unit_test.hpp>
+
+#include "../EA.h"
+#include "core/StrategyFixture.h"
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <sys/resource.h>
+
+namespace ea {
+
+namespace test {
+
+using boost::property_tree::ptree;
+
+BOOST_AUTO_TEST_SUITE(BenchmarkHookTest)
+
+BOOST_FIXTURE_TEST_CASE(SummaryTest, StrategyFixture) {
+	const string file = "benchmark.json";
+
+	// The generations and evaluations before the hook started are not counted
+	PopulationPtr population = CreateStrategy(5)->Evolve()->GetPopulation();
+	ullong generation = population->GetGeneration();
+	ullong evaluation = population->GetEvaluation();
+
+	struct rusage before = { };
+	getrusage(RUSAGE_SELF, &before);
+
+	auto strategy = CreateStrategy(10);
+	strategy->hooks.Create<BenchmarkHook>(file)->SetLabel("sphere \"8\"");
+	strategy->Evolve(population);
+
+	ptree summary;
+	BOOST_REQUIRE_NO_THROW(read_json(file, summary));
+
+	BOOST_CHECK(summary.get<string>("label") == "sphere \"8\"");
+	BOOST_CHECK(summary.get<string>("strategy") == "EvolutionStrategy");
+	BOOST_CHECK(summary.get<uint>("threads") == MultiThreading::GetRealNumThreads());
+	BOOST_CHECK(summary.get<uint>("ranks") == 1);
+
+	ullong generations = population->GetGeneration() - generation;
+	BOOST_CHECK(summary.get<ullong>("generations") == generations);
+	BOOST_CHECK(summary.get<ullong>("evaluations") == population->GetEvaluation() - evaluation);
+	double seconds = summary.get<double>("seconds");
+	BOOST_CHECK(seconds > 0);
+	BOOST_CHECK_CLOSE(summary.get<double>("gens_per_sec"), generations / seconds, 1e-3);
+
+	// The resource usage covers the whole process
+	BOOST_CHECK(summary.get<double>("user_seconds") >= before.ru_utime.tv_sec + before.ru_utime.tv_usec / 1e6 - 1e-6);
+	BOOST_CHECK(summary.get<double>("system_seconds") >= before.ru_stime.tv_sec + before.ru_stime.tv_usec / 1e6 - 1e-6);
+	BOOST_CHECK(summary.get<long>("peak_rss_kb") >= before.ru_maxrss);
+	BOOST_CHECK(summary.get<long>("peak_rss_kb") > 0);
+
+	// One record per phase of the Strategy, then the whole generations
+	vector<string> order = strategy->GetTimeRecordOrder();
+	order.push_back("Total");
+	vector<string> ids;
+	for (auto& phase : summary.get_child("phases")) {
+		ids.push_back(phase.second.get<string>("id"));
+		BOOST_CHECK(phase.second.get<ullong>("count") == generations);
+		BOOST_CHECK(phase.second.get<double>("p50") <= phase.second.get<double>("max"));
+	}
+	BOOST_CHECK(ids == order);
+
+	boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}	// namespace test
+
+}	// namespace ea
@@ -0,0 +1,106 @@
+/*
+ * FitnessHistoryTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../EA.h"
+#include "../hook/realtimeinfo/FitnessHistory.h"
+#include <thread>
+
+namespace ea {
+namespace test {
+
+BOOST_AUTO_TEST_SUITE(FitnessHistoryTest)
+
+BOOST_AUTO_TEST_CASE(QueryTest) {
+	const ullong generations = 200000;
+	FitnessHistory history(1000, 4);
+	for (ullong gen = 1; gen <= generations; gen++)
+		history.Add(gen, gen, gen, gen, 0);
+
+	ullong ranges[][3] = { { 1, generations, 50 }, { generations - 30, generations, 100 }, { 1000, 90000, 20 } };
+	for (auto& range : ranges) {
+		auto buckets = history.Query(range[0], range[1], range[2]);
+		BOOST_REQUIRE(!buckets.empty());
+		BOOST_CHECK(buckets.size() <= range[2]);
+		BOOST_CHECK(buckets.front().from <= range[0]);
+		BOOST_CHECK(buckets.back().from + buckets.back().count > range[1]);
+
+		// Consecutive and exactly merged
+		bool correct = true;
+		for (uint i = 0; i < buckets.size(); i++) {
+			auto& bucket = buckets[i];
+			if (i > 0 && bucket.from != buckets[i - 1].from + buckets[i - 1].count)
+				correct = false;
+			if (bucket.min != bucket.from || bucket.max != bucket.from + bucket.count - 1)
+				correct = false;
+			if (abs(bucket.mean - (bucket.from + (bucket.count - 1) / 2.0)) > 1e-6 * bucket.mean)
+				correct = false;
+		}
+		BOOST_CHECK(correct);
+	}
+
+	// Recent generations are kept individually, old ones are aggregated
+	FitnessHistory::Bucket bucket;
+	BOOST_REQUIRE(history.Get(generations - 5, bucket));
+	BOOST_CHECK(bucket.from == generations - 5 && bucket.count == 1);
+	BOOST_REQUIRE(history.Get(10, bucket));
+	BOOST_CHECK(bucket.from <= 10 && bucket.count > 1);
+	BOOST_REQUIRE(history.GetLast(bucket));
+	BOOST_CHECK(bucket.from == generations);
+	BOOST_CHECK(history.GetRecent(generations - 9).size() == 10);
+}
+
+BOOST_AUTO_TEST_CASE(MergeTest) {
+	FitnessHistory history(20, 2);
+	history.Add(0, 1, 3, 2, 1);
+	history.Add(1, 0, 8, 4, 2);
+
+	auto buckets = history.Query(0, 1, 1);
+	BOOST_REQUIRE(buckets.size() == 1);
+	BOOST_CHECK(buckets[0].count == 2);
+	BOOST_CHECK(buckets[0].min == 0 && buckets[0].max == 8);
+	BOOST_CHECK_CLOSE(buckets[0].mean, 3, 1e-9);
+	// E[x^2] = ((1 + 4) + (4 + 16)) / 2 = 12.5, variance = 12.5 - 9
+	BOOST_CHECK_CLOSE(buckets[0].sd, sqrt(3.5), 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentQueryTest) {
+	const ullong generations = 100000;
+	FitnessHistory history(2000, 4);
+
+	// The queries run while the generations are added and must only return consistent buckets
+	atomic<bool> done(false), correct(true);
+	thread reader([&] {
+		FitnessHistory::Bucket last;
+		while (!done) {
+			if (!history.GetLast(last))
+				continue;
+			auto buckets = history.Query(0, last.from, 50);
+			for (uint i = 0; i < buckets.size(); i++) {
+				auto& bucket = buckets[i];
+				if (bucket.min != bucket.from || bucket.max != bucket.from + bucket.count - 1)
+					correct = false;
+				if (i > 0 && bucket.from != buckets[i - 1].from + buckets[i - 1].count)
+					correct = false;
+			}
+			if (buckets.empty() || buckets.back().from + buckets.back().count <= last.from)
+				correct = false;
+		}
+	});
+
+	for (ullong gen = 1; gen <= generations; gen++)
+		history.Add(gen, gen, gen, gen, 0);
+	done = true;
+	reader.join();
+	BOOST_CHECK(correct);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}}
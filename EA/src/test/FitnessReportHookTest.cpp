@@ -0,0 +1,118 @@
+/*
+ * FitnessReportHookTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#define BOOST_TEST_DYN_LINK
+#include "../pch.h"
+#include <boost/test/unit_test.hpp>
+
+#include "../EA.h"
+#include "core/StrategyFixture.h"
+#include <boost/filesystem.hpp>
+
+namespace ea {
+
+namespace test {
+
+// Record the fitness values of the main pool at every generation
+class FitnessProbe: public Hook {
+public:
+	EA_TYPEINFO_DEFAULT(FitnessProbe)
+
+	map<ullong, vector<double>> values;
+
+private:
+	inline virtual void DoGenerational() override {
+		vector<double>& row = values[GetGeneration()];
+		for (OrganismPtr organism : *GetMainPool())
+			row.push_back(organism->GetFitnessValue());
+	}
+};
+
+BOOST_AUTO_TEST_SUITE(FitnessReportHookTest)
+
+BOOST_FIXTURE_TEST_CASE(RoundTripTest, StrategyFixture) {
+	const string file = "fitness.eafh";
+
+	for (string codec : { BackupCodec::NONE, BackupCodec::ZLIB })
+		for (bool summary : { false, true }) {
+			auto strategy = CreateStrategy(10);
+			auto hook = strategy->hooks.Create<FitnessReportHook>(file, 0, true);
+			hook->SetFormat(FitnessReportHook::FORMAT_BINARY);
+			hook->SetCodec(codec);
+			hook->SetSummary(summary);
+			auto probe = strategy->hooks.Create<FitnessProbe>();
+			strategy->Evolve();
+
+			FitnessHistoryReader reader(file);
+			BOOST_CHECK(reader.GetCodec() == codec);
+			BOOST_CHECK(reader.IsSummary() == summary);
+
+			auto rows = reader.ReadAll();
+			BOOST_REQUIRE(rows.size() == probe->values.size());
+			auto expected = probe->values.begin();
+			for (auto& row : rows) {
+				BOOST_CHECK(row.generation == expected->first);
+				const vector<double>& values = (expected++)->second;
+				BOOST_CHECK(row.size == SIZE);
+
+				if (!summary) {
+					BOOST_CHECK(row.values == values);
+					continue;
+				}
+
+				double sum = 0;
+				for (double value : values)
+					sum += value;
+				BOOST_REQUIRE(row.values.size() == FitnessReportHook::SUMMARY_SIZE);
+				BOOST_CHECK(row.values[0] == *min_element(values.begin(), values.end()));
+				BOOST_CHECK(row.values[1] == *max_element(values.begin(), values.end()));
+				BOOST_CHECK_CLOSE(row.values[2], sum / values.size(), 1e-9);
+				BOOST_CHECK(row.values[3] >= 0);
+			}
+		}
+
+	boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_CASE(InterruptedTest) {
+	const string file = "fitness.eafh";
+
+	PopulationPtr population = make_shared<Population>();
+	OrganismPoolPtr pool = make_shared<OrganismPool>();
+	for (uint i = 0; i < 10; i++) {
+		vector<double> genes(4, i);
+		pool->push_back(make_shared<Organism>(make_shared<DoubleArrayGenome>(genes), make_shared<ScalarFitness>(i)));
+	}
+	population->SetPool(0, pool);
+	SessionPtr session = make_shared<Session>(population, nullptr);
+
+	// The evolution stops (e.g. with an exception) before DoEnd(), the stream is completed when the Hook is destroyed
+	auto hook = make_shared<FitnessReportHook>(file, 0, true);
+	hook->SetFormat(FitnessReportHook::FORMAT_BINARY);
+	hook->SetCodec(BackupCodec::ZLIB);
+	(*hook)(session, &Hook::Initial);
+	for (uint i = 0; i < 3; i++) {
+		population->IncreaseGeneration();
+		(*hook)(session, &Hook::Generational);
+	}
+	hook = nullptr;
+
+	FitnessHistoryReader reader(file);
+	vector<FitnessHistoryReader::Row> rows;
+	BOOST_REQUIRE_NO_THROW(rows = reader.ReadAll());
+	BOOST_REQUIRE(rows.size() == 3);
+	BOOST_CHECK(rows.back().generation == 3);
+	BOOST_CHECK(rows.back().values.size() == 10 && rows.back().values[9] == 9);
+
+	boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}	// namespace test
+
+}	// namespace ea
@@ -157,6 +157,7 @@ BOOST_FIXTURE_TEST_CASE(FileTest, LogFixture) {
 	BOOST_CHECK_NO_THROW(Log::Redirect(Log::ERROR, "file2.log"));
 
 	BOOST_CHECK_NO_THROW(PushMessage());
+	Log::Flush();
 	Restore();
 
 	ifstream ifs("stdout.log");
@@ -183,6 +184,32 @@ BOOST_FIXTURE_TEST_CASE(FileTest, LogFixture) {
 	remove("file2.log");
 }
 
+BOOST_FIXTURE_TEST_CASE(DisabledTest, LogFixture) {
+	Log::Clear(Log::INFO);
+	uint evaluated = 0;
+	auto message = [&evaluated] () {
+		evaluated++;
+		return "Message";
+	};
+
+	// A disabled level does not evaluate the message
+	BOOST_CHECK(!Log::IsEnabled(Log::TRACE) && !Log::IsEnabled(Log::INFO) && Log::IsEnabled(Log::DEBUG));
+	EA_LOG_TRACE << message() << flush;
+	EA_LOG_INFO << message() << flush;
+	BOOST_CHECK(evaluated == 0);
+	LogStream(Log::INFO) << message() << flush;
+	BOOST_CHECK(evaluated == 1);
+
+	EA_LOG_DEBUG << message() << flush;
+	BOOST_CHECK(evaluated == 2);
+	Restore();
+
+	ifstream ifs("stdout.log");
+	CheckLine(ifs, "Message\e[0m", COLOR + TIMESTAMP);
+	CheckEOF(ifs);
+	ifs.close();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }// namespace test
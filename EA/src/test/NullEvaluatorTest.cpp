@@ -0,0 +1,106 @@
+/*
+ * NullEvaluatorTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#define BOOST_TEST_DYN_LINK
+#include "../pch.h"
+#include <boost/test/unit_test.hpp>
+
+#include "../EA.h"
+#include "core/StrategyFixture.h"
+
+namespace ea {
+
+namespace test {
+
+BOOST_AUTO_TEST_SUITE(NullEvaluatorTest)
+
+struct NullEvaluatorFixture {
+	// Reference SplitMix64 generator, mapped to [0, 1) like NullEvaluator
+	vector<double> Expected(ullong pSeed, uint pCount) {
+		vector<double> values;
+		ullong state = pSeed;
+		for (uint i = 0; i < pCount; i++) {
+			ullong z = (state += 0x9E3779B97F4A7C15ull);
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+			values.push_back(((z ^ (z >> 31)) >> 11) / 9007199254740992.0);
+		}
+		return values;
+	}
+
+	GenomePoolPtr CreateGenomes(uint pCount) {
+		GenomePoolPtr pool = make_shared<GenomePool>();
+		for (uint i = 0; i < pCount; i++) {
+			vector<double> genes(4, i);
+			pool->push_back(make_shared<DoubleArrayGenome>(genes));
+		}
+		return pool;
+	}
+
+	vector<double> Sorted(const OrganismPoolPtr& pPool) {
+		vector<double> values;
+		for (auto& organism : *pPool)
+			values.push_back(organism->GetFitnessValue());
+		sort(values.begin(), values.end());
+		return values;
+	}
+};
+
+BOOST_FIXTURE_TEST_CASE(SplitMixTest, NullEvaluatorFixture) {
+	// First output of SplitMix64 with seed 0
+	BOOST_CHECK(Expected(0, 1)[0] == (0xE220A8397B1DCDAFull >> 11) / 9007199254740992.0);
+
+	PopulationPtr population = make_shared<Population>();
+	SessionPtr session = make_shared<Session>(population, nullptr);
+	auto evaluator = make_shared<NullEvaluator>(false, 7);
+	BOOST_CHECK(!evaluator->IsMaximizer());
+	BOOST_CHECK(evaluator->GetSeed() == 7);
+
+	// The fitness is the SplitMix64 output of the evaluation index, whatever the genome
+	// (genomes may be evaluated in parallel, so the values are compared as sets)
+	vector<double> expected = Expected(7, 20);
+	OrganismPoolPtr first = (*evaluator)(session, CreateGenomes(10));
+	BOOST_REQUIRE(first->size() == 10);
+	BOOST_CHECK(population->GetEvaluation() == 10);
+	vector<double> head(expected.begin(), expected.begin() + 10);
+	sort(head.begin(), head.end());
+	BOOST_CHECK(Sorted(first) == head);
+	for (auto& organism : *first)
+		BOOST_CHECK(!static_pointer_cast<ScalarFitness>(organism->GetFitness())->IsMaximizer());
+
+	OrganismPoolPtr second = (*evaluator)(session, CreateGenomes(10));
+	BOOST_CHECK(population->GetEvaluation() == 20);
+	vector<double> tail(expected.begin() + 10, expected.end());
+	sort(tail.begin(), tail.end());
+	BOOST_CHECK(Sorted(second) == tail);
+
+	// Another evaluator with the same seed gives the same values, another seed does not
+	BOOST_CHECK(Sorted((*make_shared<NullEvaluator>(false, 7))(session, CreateGenomes(10))) == head);
+	BOOST_CHECK(Sorted((*make_shared<NullEvaluator>(false, 8))(session, CreateGenomes(10))) != head);
+}
+
+BOOST_FIXTURE_TEST_CASE(StrategyTest, StrategyFixture) {
+	NullEvaluatorFixture fixture;
+
+	auto strategy = CreateStrategy(5);
+	strategy->evaluator.Create<NullEvaluator>(true, 3);
+	PopulationPtr population = strategy->Evolve()->GetPopulation();
+
+	// Every evaluation is counted and each fitness comes from one of them
+	ullong evaluation = population->GetEvaluation();
+	BOOST_CHECK(evaluation > SIZE);
+	vector<double> expected = fixture.Expected(3, evaluation);
+	sort(expected.begin(), expected.end());
+	for (auto& organism : *population->GetOrganismPool(0))
+		BOOST_CHECK(binary_search(expected.begin(), expected.end(), organism->GetFitnessValue()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}	// namespace test
+
+}	// namespace ea
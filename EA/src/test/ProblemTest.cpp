@@ -0,0 +1,105 @@
+/*
+ * ProblemTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../EA.h"
+
+namespace ea {
+namespace test {
+
+BOOST_AUTO_TEST_SUITE(ProblemTest)
+
+BOOST_AUTO_TEST_CASE(ContinuousTest) {
+	const uint dim = 12;
+	vector<ContinuousFunctionPtr> functions = {
+		make_shared<SphereFunction>(2, true, 7),
+		make_shared<EllipsoidFunction>(2, true, 7),
+		make_shared<RastriginFunction>(2, true, 7),
+		make_shared<RosenbrockFunction>(2, true, 7),
+		make_shared<AckleyFunction>(2, true, 7)
+	};
+
+	for (auto& function : functions) {
+		// The optimum is 0 at the shift vector, any other point is worse
+		BOOST_CHECK(function->Compute(vector<double>(dim, 3).data(), dim) > 1e-3);
+		auto& optimum = function->GetShiftVector();
+		BOOST_CHECK_SMALL(function->Compute(optimum.data(), dim), 1e-9);
+		BOOST_CHECK(optimum.size() == dim && optimum.cwiseAbs().maxCoeff() <= 2 && optimum.norm() > 0);
+
+		// The rotation is orthogonal
+		auto& rotation = function->GetRotationMatrix();
+		BOOST_CHECK((rotation * rotation.transpose() - Eigen::MatrixXd::Identity(dim, dim)).norm() < 1e-9);
+
+		auto genome = make_shared<DoubleArrayGenome>();
+		genome->GetGenes().assign(dim + 1, 0);
+		BOOST_CHECK_THROW(function->Evaluate(genome), EAException);
+	}
+
+	// The same seed gives the same instance, and a rotated sphere is the norm of the shifted point
+	SphereFunction sphere(2, false, 7), rotated(2, true, 7);
+	vector<double> x(dim, 1);
+	BOOST_CHECK_CLOSE(sphere.Compute(x.data(), dim), rotated.Compute(x.data(), dim), 1e-9);
+	BOOST_CHECK(sphere.GetShiftVector() == rotated.GetShiftVector());
+
+	RastriginFunction rastrigin;
+	BOOST_CHECK_CLOSE(rastrigin.Compute(x.data(), dim), 1.0 * dim, 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(DiscreteTest) {
+	auto bits = make_shared<BoolArrayGenome>();
+	bits->GetGenes() = { true, true, false, true, true, true, false, false };
+	BOOST_CHECK_EQUAL(make_shared<OneMaxFunction>()->Evaluate(bits)->GetFitnessValue(), 5);
+	BOOST_CHECK_EQUAL(make_shared<LeadingOnesFunction>()->Evaluate(bits)->GetFitnessValue(), 2);
+
+	// Two genes interact if and only if they share a window of K + 1 genes (circularly)
+	const uint k = 2, n = bits->GetSize();
+	auto nk = make_shared<NKLandscapeFunction>(k, 5);
+	auto& genes = bits->GetGenes();
+	auto fitness = [&nk, &bits] () { return nk->Evaluate(bits)->GetFitnessValue(); };
+	double base = fitness();
+	BOOST_CHECK(base > 0 && base < 1);
+	BOOST_CHECK_EQUAL(make_shared<NKLandscapeFunction>(k, 5)->Evaluate(bits)->GetFitnessValue(), base);
+
+	vector<double> deltas(n);
+	for (uint i = 0; i < n; i++) {
+		genes[i] = !genes[i];
+		deltas[i] = fitness() - base;
+		genes[i] = !genes[i];
+	}
+	bool correct = true;
+	for (uint i = 0; i < n; i++)
+		for (uint j = i + 1; j < n; j++) {
+			genes[i] = !genes[i];
+			genes[j] = !genes[j];
+			bool additive = abs(fitness() - base - deltas[i] - deltas[j]) < 1e-12;
+			genes[i] = !genes[i];
+			genes[j] = !genes[j];
+			if (additive != (min(j - i, n - (j - i)) > k))
+				correct = false;
+		}
+	BOOST_CHECK(correct);
+	BOOST_CHECK_THROW(make_shared<NKLandscapeFunction>(n, 5)->Evaluate(bits), EAException);
+
+	// The tour is closed
+	auto tour = make_shared<PermutationGenome>();
+	tour->GetGenes() = { 0, 1, 2, 3 };
+	auto tsp = make_shared<TSPFunction>(3);
+	double length = tsp->Evaluate(tour)->GetFitnessValue();
+	auto& cx = tsp->GetX();
+	auto& cy = tsp->GetY();
+	double expectedLength = 0;
+	for (uint i = 0; i < 4; i++)
+		expectedLength += hypot(cx[(i + 1) % 4] - cx[i], cy[(i + 1) % 4] - cy[i]);
+	BOOST_CHECK_CLOSE(length, expectedLength, 1e-9);
+	BOOST_CHECK(!tsp->IsMaximizer());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}}
@@ -0,0 +1,97 @@
+/*
+ * RealTimeInfoHookTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#define BOOST_TEST_DYN_LINK
+#include "../pch.h"
+#include <boost/test/unit_test.hpp>
+
+#include "../EA.h"
+#include "core/StrategyFixture.h"
+
+namespace ea {
+
+namespace test {
+
+using boost::property_tree::ptree;
+
+// Query the statistics of a RealTimeInfoHook at the last generation of the run
+class RealTimeInfoProbe: public Hook {
+public:
+	EA_TYPEINFO_DEFAULT(RealTimeInfoProbe)
+
+	Ptr<RealTimeInfoHook> hook;
+	ptree timings, throughput, threads, cluster;
+
+private:
+	inline virtual void DoGenerational() override {
+		timings = hook->GetTimings();
+		throughput = hook->GetThroughput();
+		threads = hook->GetThreads();
+		cluster = hook->GetCluster();
+	}
+};
+
+BOOST_AUTO_TEST_SUITE(RealTimeInfoHookTest)
+
+BOOST_FIXTURE_TEST_CASE(StatisticsTest, StrategyFixture) {
+	auto strategy = CreateStrategy(5);
+	auto hook = strategy->hooks.Create<RealTimeInfoHook>();
+	auto probe = strategy->hooks.Create<RealTimeInfoProbe>();
+	probe->hook = hook;
+
+	// No statistics before the evolution starts
+	BOOST_CHECK(hook->GetTimings().empty());
+
+	auto population = strategy->Evolve()->GetPopulation();
+
+	// Timings
+	BOOST_REQUIRE(!probe->timings.empty());
+	BOOST_CHECK(!probe->timings.get_child("phases").empty());
+	BOOST_CHECK(probe->timings.get<ullong>("total.count") > 0);
+	BOOST_CHECK(hook->GetTimings().empty());
+
+	// Throughput
+	BOOST_CHECK_EQUAL(probe->throughput.get<ullong>("generation"), population->GetGeneration());
+	BOOST_CHECK_EQUAL(probe->throughput.get<ullong>("evaluation"), population->GetEvaluation());
+	BOOST_CHECK(probe->throughput.get<double>("evaluations-per-second") > 0);
+	BOOST_CHECK(probe->throughput.get<ullong>("recent.generations") > 0);
+
+	// Threads
+	size_t threads = MultiThreading::GetThreadStats().size();
+	BOOST_CHECK_EQUAL(probe->threads.get<size_t>("threads"), threads);
+	BOOST_CHECK_EQUAL(probe->threads.get_child("per-thread").size(), threads);
+	BOOST_CHECK(probe->threads.get<double>("utilisation") <= 1);
+
+	// Cluster
+	BOOST_CHECK_EQUAL(probe->cluster.get<bool>("enabled"), Cluster::IsEnabled());
+	BOOST_CHECK_EQUAL(probe->cluster.get_child("per-worker").size(), Cluster::GetWorkerStats().size());
+}
+
+BOOST_FIXTURE_TEST_CASE(ResumedThroughputTest, StrategyFixture) {
+	auto population = CreateStrategy(5)->Evolve()->GetPopulation();
+	ullong generation = population->GetGeneration();
+	ullong evaluation = population->GetEvaluation();
+
+	// The generations and evaluations before the hook started are not counted
+	auto strategy = CreateStrategy(10);
+	auto hook = strategy->hooks.Create<RealTimeInfoHook>();
+	auto probe = strategy->hooks.Create<RealTimeInfoProbe>();
+	probe->hook = hook;
+	strategy->Evolve(population);
+
+	double evaluations = probe->throughput.get<double>("evaluations-per-second");
+	double generations = probe->throughput.get<double>("generations-per-second");
+	BOOST_REQUIRE(generations > 0);
+	BOOST_CHECK_CLOSE(evaluations / generations,
+			double(population->GetEvaluation() - evaluation) / (population->GetGeneration() - generation), 1e-3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}	// namespace test
+
+}	// namespace ea
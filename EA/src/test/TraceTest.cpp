@@ -0,0 +1,142 @@
+/*
+ * TraceTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#define BOOST_TEST_DYN_LINK
+#include "../pch.h"
+#include <boost/test/unit_test.hpp>
+
+#include "../EA.h"
+#include "core/StrategyFixture.h"
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+namespace ea {
+
+namespace test {
+
+using boost::property_tree::ptree;
+
+BOOST_AUTO_TEST_SUITE(TraceTest)
+
+struct TraceFixture {
+	struct Event {
+		string name, category;
+		uint tid;
+		double start, end;
+		ptree args;
+
+		// Whether this event lies within another event of the same thread
+		bool IsIn(const Event& pOther) const {
+			return tid == pOther.tid && start >= pOther.start - 1e-3 && end <= pOther.end + 1e-3;
+		}
+	};
+
+	// Parse the recorded events (metadata events are skipped)
+	vector<Event> Parse(istream& pStream) {
+		ptree trace;
+		read_json(pStream, trace);
+		vector<Event> events;
+		for (auto& child : trace.get_child("traceEvents")) {
+			const ptree& event = child.second;
+			if (event.get<string>("ph") != "X")
+				continue;
+			double start = event.get<double>("ts");
+			events.push_back({ event.get<string>("name"), event.get<string>("cat"), event.get<uint>("tid"),
+					start, start + event.get<double>("dur"), event.get_child("args", ptree()) });
+		}
+		return events;
+	}
+
+	~TraceFixture() {
+		Tracer::Stop();
+		Tracer::Clear();
+	}
+};
+
+BOOST_FIXTURE_TEST_CASE(ScopeTest, TraceFixture) {
+	Tracer::Clear();
+	{
+		Tracer::Scope disabled("disabled", "test");
+	}
+
+	Tracer::Start();
+	BOOST_CHECK(Tracer::IsEnabled());
+	{
+		Tracer::Scope outer(string("outer \"quoted\"\n"), "test");
+		{
+			Tracer::Scope inner("inner", "test");
+			inner.AddArg("count", 3);
+		}
+	}
+	Tracer::Stop();
+	{
+		Tracer::Scope stopped("stopped", "test");
+	}
+
+	stringstream ss;
+	Tracer::Write(ss);
+	vector<Event> events;
+	BOOST_REQUIRE_NO_THROW(events = Parse(ss));
+
+	// Events are recorded when they end, the names are escaped
+	BOOST_REQUIRE(events.size() == 2);
+	const Event& inner = events[0];
+	const Event& outer = events[1];
+	BOOST_CHECK(inner.name == "inner");
+	BOOST_CHECK(outer.name == "outer \"quoted\"\n");
+	BOOST_CHECK(inner.category == "test" && outer.category == "test");
+	BOOST_CHECK(inner.args.get<double>("count") == 3);
+	BOOST_CHECK(outer.args.empty());
+	BOOST_CHECK(inner.IsIn(outer));
+	BOOST_CHECK(inner.end - inner.start >= 0);
+
+	Tracer::Clear();
+	stringstream empty;
+	Tracer::Write(empty);
+	BOOST_CHECK(Parse(empty).empty());
+}
+
+BOOST_FIXTURE_TEST_CASE(TraceHookTest, StrategyFixture) {
+	const string file = "trace.json";
+	TraceFixture fixture;
+
+	auto strategy = CreateStrategy(5);
+	strategy->hooks.Create<TraceHook>(file);
+	strategy->Evolve();
+	BOOST_CHECK(!Tracer::IsEnabled());
+
+	std::ifstream ifs(file);
+	vector<TraceFixture::Event> events;
+	BOOST_REQUIRE_NO_THROW(events = fixture.Parse(ifs));
+
+	vector<TraceFixture::Event> generations, phases, hooks;
+	for (auto& event : events) {
+		if (event.category == "strategy")
+			generations.push_back(event);
+		else if (event.category == "phase")
+			phases.push_back(event);
+		else if (event.category == "hook")
+			hooks.push_back(event);
+	}
+	BOOST_CHECK(generations.size() == 5);
+	BOOST_CHECK(!phases.empty());
+	BOOST_CHECK(!hooks.empty());
+
+	// Every phase runs within a generation
+	for (auto& phase : phases)
+		BOOST_CHECK(any_of(generations.begin(), generations.end(), [&phase] (const TraceFixture::Event& pGeneration) {
+			return phase.IsIn(pGeneration);
+		}));
+
+	boost::filesystem::remove(file);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}	// namespace test
+
+}	// namespace ea
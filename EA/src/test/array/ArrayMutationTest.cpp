@@ -0,0 +1,103 @@
+/*
+ * ArrayMutationTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../../EA.h"
+
+namespace ea {
+namespace test {
+
+struct FlipBitFixture {
+	// Mutate a genome many times and return the average number of flipped genes
+	double Run(double rate, uint length, uint trials = 400) {
+		vector<bool> genes(length);
+		for (uint i = 0; i < length; i += 3)
+			genes[i] = true;
+		auto target = make_shared<BoolArrayGenome>();
+		target->GetGenes() = genes;
+
+		MutatorPtr mutator = make_shared<FlipBitMutation>(rate);
+		ullong flips = 0;
+		for (uint t = 0; t < trials; t++) {
+			auto child = dynamic_pointer_cast<BoolArrayGenome>(mutator->Apply(target));
+			auto& childGenes = child->GetGenes();
+			if (childGenes.size() != length || target->GetGenes() != genes)
+				return -1;
+			for (uint i = 0; i < length; i++)
+				flips += childGenes[i] != genes[i];
+		}
+		return double(flips) / trials;
+	}
+};
+
+BOOST_AUTO_TEST_SUITE(ArrayMutationTest)
+
+BOOST_FIXTURE_TEST_CASE(FlipBitMutationTest, FlipBitFixture) {
+	BOOST_CHECK_EQUAL(Run(0, 1000), 0);
+	BOOST_CHECK_EQUAL(Run(1, 1000), 1000);
+	BOOST_CHECK_EQUAL(Run(0.5, 0), 0);
+
+	// Sampled positions (e.g. 0.1 or 0.3) and random masks (0.5)
+	BOOST_CHECK_CLOSE(Run(0.001, 10000), 10, 10);
+	BOOST_CHECK_CLOSE(Run(0.1, 1000), 100, 5);
+	BOOST_CHECK_CLOSE(Run(0.3, 1000), 300, 5);
+	BOOST_CHECK_CLOSE(Run(0.5, 1001), 500.5, 5);
+
+	// All the bits flipped, then flipped back with the complementary rate (by masks or by sampling)
+	BOOST_CHECK_CLOSE(Run(0.75, 70), 52.5, 5);
+	BOOST_CHECK_CLOSE(Run(0.9, 70), 63, 5);
+}
+
+#ifdef EA_BIT_WORDS
+BOOST_AUTO_TEST_CASE(BitWordsTest) {
+	// The fill constructor clears the whole words, so the unused bits start clear
+	const uint length = 150;
+	vector<bool> bits(length, false), ones(length, true);
+	auto unused = [&bits] () {
+		return BitWords::Get(bits)[BitWords::Count(length) - 1] & ~BitWords::LastMask(length);
+	};
+	BOOST_CHECK_EQUAL(BitWords::Count(length), 3u);
+	BOOST_CHECK_EQUAL(unused(), 0u);
+
+	BitWords::Flip(bits);
+	BOOST_CHECK(bits == ones);
+	BOOST_CHECK_EQUAL(unused(), 0u);
+
+	bits.assign(length, false);
+	BitWords::Copy(bits, ones, 10, 20);
+	BitWords::Copy(bits, ones, 60, length);
+	BOOST_CHECK_EQUAL(size_t(count(bits.begin(), bits.end(), true)), 10 + length - 60);
+	BOOST_CHECK(bits[10] && bits[19] && !bits[20] && !bits[59] && bits[60] && bits[length - 1]);
+	BOOST_CHECK_EQUAL(unused(), 0u);
+}
+#endif
+
+BOOST_AUTO_TEST_CASE(PointResetMutationTest) {
+	auto target = make_shared<IntArrayGenome>();
+	target->GetGenes().assign(1000, 1);
+
+	// Without duplicates, every sampled gene takes a new value
+	MutatorPtr mutator = make_shared<IntPointResetMutation>(0.05, make_shared<IntRandomizer>(0, 3));
+	ullong resets = 0;
+	for (uint t = 0; t < 400; t++) {
+		auto child = dynamic_pointer_cast<IntArrayGenome>(mutator->Apply(target));
+		for (int gene : child->GetGenes())
+			resets += gene != 1;
+	}
+	BOOST_CHECK_CLOSE(resets / 400.0, 50, 5);
+	BOOST_CHECK(target->GetGenes() == vector<int>(1000, 1));
+
+	auto child = dynamic_pointer_cast<IntArrayGenome>(
+			make_shared<IntPointResetMutation>(1, make_shared<IntRandomizer>(0, 3))->Apply(target));
+	BOOST_CHECK(count(child->GetGenes().begin(), child->GetGenes().end(), 1) == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}}
@@ -0,0 +1,107 @@
+/*
+ * ArrayRecombinationTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../../EA.h"
+
+namespace ea {
+namespace test {
+
+template<class T>
+struct ArrayRecombinationFixture {
+	ArrayGenomePtr<T> first, second;
+
+	// The first parent only has 0s and the second one only has 1s
+	void Prepare(uint firstLength, uint secondLength) {
+		first = make_shared<ArrayGenome<T>>();
+		first->GetGenes().assign(firstLength, T(0));
+		second = make_shared<ArrayGenome<T>>();
+		second->GetGenes().assign(secondLength, T(1));
+	}
+
+	vector<T> Combine(RecombinatorPtr recombinator) {
+		vector<GenomePtr> parents = { first, second };
+		auto child = dynamic_pointer_cast<ArrayGenome<T>>(recombinator->Combine(parents));
+
+		// The parents must not be modified
+		BOOST_CHECK(first->GetGenes() == vector<T>(first->GetSize(), T(0)));
+		BOOST_CHECK(second->GetGenes() == vector<T>(second->GetSize(), T(1)));
+		return child->GetGenes();
+	}
+
+	// Return the fraction of the common genes taken from the second parent, or -1 if the child is invalid
+	double RunUniform(uint firstLength, uint secondLength, uint trials = 200) {
+		Prepare(firstLength, secondLength);
+		uint minSize = min(firstLength, secondLength);
+		T tail = T(firstLength > secondLength ? 0 : 1);
+
+		ullong fromSecond = 0;
+		for (uint t = 0; t < trials; t++) {
+			vector<T> genes = Combine(make_shared<UniformCrossover<T>>());
+			if (genes.size() != max(firstLength, secondLength))
+				return -1;
+			fromSecond += count(genes.begin(), genes.begin() + minSize, T(1));
+			if (size_t(count(genes.begin() + minSize, genes.end(), tail)) != genes.size() - minSize)
+				return -1;
+		}
+		return minSize ? double(fromSecond) / trials / minSize : 0.5;
+	}
+
+	// Check that the child switches parent exactly at the given number of points
+	bool RunNPoint(uint crossCount, uint firstLength, uint secondLength, uint trials = 200) {
+		Prepare(firstLength, secondLength);
+		uint minSize = min(firstLength, secondLength);
+		T last = T(crossCount & 1);
+
+		for (uint t = 0; t < trials; t++) {
+			vector<T> genes = Combine(make_shared<NPointCrossover<T>>(crossCount));
+			if (genes.size() != (crossCount & 1 ? secondLength : firstLength) || genes[0] != T(0))
+				return false;
+
+			uint switches = 0;
+			for (uint i = 1; i < minSize; i++)
+				switches += genes[i] != genes[i - 1];
+			if (switches != crossCount || size_t(count(genes.begin() + minSize, genes.end(), last)) != genes.size() - minSize)
+				return false;
+		}
+		return true;
+	}
+};
+
+BOOST_AUTO_TEST_SUITE(ArrayRecombinationTest)
+
+BOOST_FIXTURE_TEST_CASE(IntUniformCrossoverTest, ArrayRecombinationFixture<int>) {
+	BOOST_CHECK_CLOSE(RunUniform(1000, 700), 0.5, 5);
+	BOOST_CHECK_CLOSE(RunUniform(64, 64), 0.5, 5);
+	BOOST_CHECK_CLOSE(RunUniform(3, 130), 0.5, 20);
+}
+BOOST_FIXTURE_TEST_CASE(BoolUniformCrossoverTest, ArrayRecombinationFixture<bool>) {
+	BOOST_CHECK_CLOSE(RunUniform(1000, 701), 0.5, 5);
+	BOOST_CHECK_CLOSE(RunUniform(64, 128), 0.5, 5);
+	BOOST_CHECK_CLOSE(RunUniform(0, 5), 0.5, 1);
+}
+BOOST_FIXTURE_TEST_CASE(IntNPointCrossoverTest, ArrayRecombinationFixture<int>) {
+	BOOST_CHECK(RunNPoint(1, 100, 70));
+	BOOST_CHECK(RunNPoint(2, 100, 70));
+	BOOST_CHECK(RunNPoint(5, 20, 30));
+	BOOST_CHECK(RunNPoint(9, 10, 10));
+
+	Prepare(3, 10);
+	BOOST_CHECK_THROW(Combine(make_shared<IntNPointCrossover>(3)), EAException);
+}
+BOOST_FIXTURE_TEST_CASE(BoolNPointCrossoverTest, ArrayRecombinationFixture<bool>) {
+	BOOST_CHECK(RunNPoint(1, 1000, 700));
+	BOOST_CHECK(RunNPoint(3, 150, 133));
+	BOOST_CHECK(RunNPoint(8, 9, 200));
+	BOOST_CHECK(RunNPoint(20, 64, 65));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}}
@@ -0,0 +1,82 @@
+/*
+ * ObjectCounterTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#define BOOST_TEST_DYN_LINK
+#include "../../pch.h"
+#include <boost/test/unit_test.hpp>
+
+#include "../../EA.h"
+
+namespace ea {
+
+namespace test {
+
+BOOST_AUTO_TEST_SUITE(CoreTest)
+
+BOOST_AUTO_TEST_SUITE(ObjectCounterTest)
+
+BOOST_AUTO_TEST_CASE(CountTest) {
+	ObjectCounter::SetEnabled(true);
+	llong organisms = ObjectCounter::GetLive(ObjectCounter::ORGANISM);
+	llong genomes = ObjectCounter::GetLive(ObjectCounter::GENOME);
+	llong fitness = ObjectCounter::GetLive(ObjectCounter::FITNESS);
+
+	{
+		// The pools share one organism and one genome
+		auto genome = make_shared<DoubleArrayGenome>();
+		genome->GetGenes().assign(100, 0);
+		auto organism = make_shared<Organism>(genome, make_shared<ScalarFitness>(1));
+		auto permutation = make_shared<PermutationGenome>();
+		permutation->GetGenes() = { 0, 1, 2 };
+
+		auto organismPool = make_shared<OrganismPool>();
+		organismPool->push_back(organism);
+		organismPool->push_back(organism);
+		organismPool->push_back(make_shared<Organism>(genome));
+		auto genomePool = make_shared<GenomePool>();
+		genomePool->push_back(genome);
+		genomePool->push_back(permutation);
+
+		Population population;
+		population.SetPool(0, organismPool);
+		population.SetPool(1, genomePool);
+
+		BOOST_CHECK(ObjectCounter::GetLive(ObjectCounter::ORGANISM) == organisms + 2);
+		BOOST_CHECK(ObjectCounter::GetLive(ObjectCounter::GENOME) == genomes + 2);
+		BOOST_CHECK(ObjectCounter::GetLive(ObjectCounter::FITNESS) == fitness + 1);
+
+		auto report = ObjectCounter::Collect(population);
+		BOOST_CHECK(report.organisms.count == 2);
+		BOOST_CHECK(report.fitness.count == 1);
+		BOOST_REQUIRE(report.genomes.size() == 2);
+		BOOST_CHECK(report.genomes[0].count == 1 && report.genomes[1].count == 1);
+		BOOST_CHECK(report.genomes[0].bytes >= 100 * sizeof(double));
+		BOOST_REQUIRE(report.pools.size() == 2);
+		BOOST_CHECK(report.pools[0].count == 3 && report.pools[1].count == 2);
+
+		ostringstream oss;
+		ObjectCounter::Write(oss, report);
+		BOOST_CHECK(oss.str().find("DoubleArrayGenome 1") != string::npos);
+	}
+
+	BOOST_CHECK(ObjectCounter::GetLive(ObjectCounter::ORGANISM) == organisms);
+	BOOST_CHECK(ObjectCounter::GetLive(ObjectCounter::GENOME) == genomes);
+	BOOST_CHECK(ObjectCounter::GetLive(ObjectCounter::FITNESS) == fitness);
+
+	// Nothing is counted when disabled
+	ObjectCounter::SetEnabled(false);
+	auto genome = make_shared<DoubleArrayGenome>();
+	BOOST_CHECK(ObjectCounter::GetLive(ObjectCounter::GENOME) == genomes);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}// namespace test
+
+}// namespace ea
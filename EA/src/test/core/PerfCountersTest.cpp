@@ -0,0 +1,148 @@
+/*
+ * PerfCountersTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#define BOOST_TEST_DYN_LINK
+#include "../../pch.h"
+#include <boost/test/unit_test.hpp>
+
+#include "../../EA.h"
+#include "StrategyFixture.h"
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+namespace ea {
+
+namespace test {
+
+namespace utf = boost::unit_test;
+using boost::property_tree::ptree;
+
+BOOST_AUTO_TEST_SUITE(CoreTest)
+
+BOOST_AUTO_TEST_SUITE(PerfCountersTest)
+
+// The tests of one path are skipped (not passed) on machines taking the other path
+boost::test_tools::assertion_result Available(utf::test_unit_id) {
+	return PerfCounters::IsAvailable();
+}
+boost::test_tools::assertion_result Unavailable(utf::test_unit_id) {
+	return !PerfCounters::IsAvailable();
+}
+
+struct PerfCountersFixture: StrategyFixture {
+	const string traceFile = "counters.json";
+	const string logFile = "counters.log";
+
+	vector<Session::TimeRecord> records;	// The phase records, then the total time
+	bool reported = false;					// Whether the Counter Report was logged
+	uint phases = 0;						// The number of phase events traced
+	uint countedPhases = 0;					// The number of phase events carrying counters
+
+	// Evolve a few generations with a TraceHook, then collect what was recorded and reported
+	void Evolve(bool pCounting) {
+		Log::Redirect(Log::DEBUG, logFile);
+		auto strategy = CreateStrategy(5);
+		strategy->hooks.Create<TraceHook>(traceFile)->SetCounting(pCounting);
+		SessionPtr session = strategy->Evolve();
+		Log::Flush();
+		Log::Default(Log::DEBUG);
+		BOOST_CHECK(!PerfCounters::IsEnabled());
+
+		records = session->GetTimeRecords(strategy->GetTimeRecordOrder());
+		records.push_back(session->GetTotalTimeRecord());
+
+		std::ifstream log(logFile);
+		string line;
+		while (getline(log, line))
+			reported |= line.find("Counter Report") != string::npos;
+
+		ptree trace;
+		read_json(traceFile, trace);
+		for (auto& child : trace.get_child("traceEvents")) {
+			const ptree& event = child.second;
+			if (event.get<string>("ph") != "X" || event.get<string>("cat") != "phase")
+				continue;
+			phases++;
+			auto args = event.get_child_optional("args");
+			for (uint i = 0; args && i < PerfCounters::NUM_EVENTS; i++)
+				if (args->count(PerfCounters::GetName(i))) {
+					countedPhases++;
+					break;
+				}
+		}
+	}
+
+	// Without counters, phases are only timed
+	void CheckTimedOnly() {
+		for (auto& record : records) {
+			BOOST_CHECK(record.count > 0);
+			BOOST_CHECK(record.counted == 0);
+			for (uint i = 0; i < PerfCounters::NUM_EVENTS; i++)
+				BOOST_CHECK(record.counters[i] == 0);
+		}
+		BOOST_CHECK(!reported);
+		BOOST_CHECK(phases > 0);
+		BOOST_CHECK(countedPhases == 0);
+	}
+
+	~PerfCountersFixture() {
+		boost::filesystem::remove(traceFile);
+		boost::filesystem::remove(logFile);
+	}
+};
+
+BOOST_FIXTURE_TEST_CASE(DisabledTest, PerfCountersFixture) {
+	Evolve(false);
+	CheckTimedOnly();
+}
+
+BOOST_TEST_DECORATOR(*utf::precondition(Unavailable))
+BOOST_FIXTURE_TEST_CASE(UnavailableTest, PerfCountersFixture) {
+	PerfCounters::Values values;
+	BOOST_CHECK(!PerfCounters::Read(values));
+
+	// Enabling the counters does not change anything when they cannot be read
+	Evolve(true);
+	CheckTimedOnly();
+}
+
+BOOST_TEST_DECORATOR(*utf::precondition(Available))
+BOOST_AUTO_TEST_CASE(ReadTest) {
+	PerfCounters::Values first, second;
+	BOOST_REQUIRE(PerfCounters::Read(first));
+
+	volatile double sum = 0;
+	for (uint i = 0; i < 100000; i++)
+		sum += i;
+
+	BOOST_REQUIRE(PerfCounters::Read(second));
+	BOOST_CHECK(first.valid != 0 && first.valid == second.valid);
+	for (uint i = 0; i < PerfCounters::NUM_EVENTS; i++)
+		BOOST_CHECK(second.values[i] >= first.values[i]);
+}
+
+BOOST_TEST_DECORATOR(*utf::precondition(Available))
+BOOST_FIXTURE_TEST_CASE(AvailableTest, PerfCountersFixture) {
+	Evolve(true);
+
+	// The phases are counted, the total time is not
+	Session::TimeRecord total = records.back();
+	records.pop_back();
+	BOOST_CHECK(total.counted == 0);
+	for (auto& record : records)
+		BOOST_CHECK(record.counted > 0 && record.counted <= record.count);
+	BOOST_CHECK(reported);
+	BOOST_CHECK(countedPhases > 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}	// namespace test
+
+}	// namespace ea
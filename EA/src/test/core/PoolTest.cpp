@@ -0,0 +1,68 @@
+/*
+ * PoolTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#define BOOST_TEST_DYN_LINK
+#include "../../pch.h"
+#include <boost/test/unit_test.hpp>
+
+#include "../../EA.h"
+
+namespace ea {
+
+namespace test {
+
+// A Pool relying on the default Pool::Clone()
+class ValuePool: public Pool {
+public:
+	EA_TYPEINFO_DEFAULT(ValuePool)
+
+	vector<uint> values;
+
+protected:
+	virtual void DoSerialize(ostream& pStream) const override {
+		Write(pStream, values);
+	}
+	virtual void DoDeserialize(istream& pStream) override {
+		Read(pStream, values);
+	}
+};
+
+BOOST_AUTO_TEST_SUITE(CoreTest)
+
+BOOST_AUTO_TEST_SUITE(PoolTest)
+
+BOOST_AUTO_TEST_CASE(DefaultCloneTest) {
+	auto pool = make_shared<ValuePool>();
+	pool->values = { 1, 2, 3 };
+
+	// The second clone uses the cached TypeInfo
+	for (uint i = 0; i < 2; i++) {
+		auto copy = dynamic_pointer_cast<ValuePool>(pool->Clone());
+		BOOST_REQUIRE(copy);
+		BOOST_CHECK(copy != pool);
+		BOOST_CHECK(copy->values == pool->values);
+
+		copy->values.push_back(4);
+		BOOST_CHECK(pool->values.size() == 3);
+	}
+
+	// Snapshot() keeps the class of each Pool
+	PopulationPtr population = make_shared<Population>();
+	population->SetPool(0, pool);
+	population->SetPool(1, make_shared<OrganismPool>());
+	PopulationPtr snapshot = population->Snapshot();
+	BOOST_CHECK(dynamic_pointer_cast<ValuePool>(snapshot->GetPool(0)));
+	BOOST_CHECK(snapshot->GetOrganismPool(1));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}	// namespace test
+
+}	// namespace ea
@@ -0,0 +1,43 @@
+/*
+ * StrategyFixture.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../../EA.h"
+
+namespace ea {
+
+namespace test {
+
+using namespace std;
+
+struct StrategyFixture {
+	static const uint SIZE = 20;
+	static const uint LENGTH = 8;
+
+	// A small EvolutionStrategy maximizing the negative sphere function until the given generation
+	EvolutionStrategyPtr CreateStrategy(ullong pGenerations) {
+		EvolutionStrategyPtr strategy = make_shared<EvolutionStrategy>(SIZE);
+		strategy->initializer.Create<DoubleRandomArrayInitializer>(LENGTH, make_shared<DoubleRandomizer>(-1, 1));
+		strategy->evaluator.Create<TypedFunctionalEvaluator<DoubleArrayGenome>>(
+				[] (const DoubleArrayGenomePtr& pGenome) {
+					double sum = 0;
+					for (double gene : pGenome->GetGenes())
+						sum -= gene * gene;
+					return sum;
+				});
+		strategy->recombinators.CreateBase<DoubleUniformCrossover>()->Parent<UniformSelection>();
+		strategy->mutators.CreateBase<DoublePointResetMutation>(0.1, make_shared<DoubleRandomizer>(-1, 1));
+		strategy->survivalSelector.Create<GreedySelection>();
+		strategy->hooks.Create<GenerationTerminationHook>(pGenerations, false);
+		return strategy;
+	}
+};
+
+}// namespace test
+
+}// namespace ea
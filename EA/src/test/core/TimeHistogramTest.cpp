@@ -0,0 +1,57 @@
+/*
+ * TimeHistogramTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#define BOOST_TEST_DYN_LINK
+#include "../../pch.h"
+#include <boost/test/unit_test.hpp>
+
+#include "../../EA.h"
+
+namespace ea {
+
+namespace test {
+
+BOOST_AUTO_TEST_SUITE(CoreTest)
+
+BOOST_AUTO_TEST_SUITE(TimeHistogramTest)
+
+BOOST_AUTO_TEST_CASE(PercentileTest) {
+	TimeHistogram histogram;
+	BOOST_CHECK(histogram.GetPercentile(50) == 0);
+
+	for (ullong i = 1; i <= 1000; i++)
+		histogram.Add(i * 1000000);
+
+	BOOST_CHECK(histogram.GetCount() == 1000);
+	BOOST_CHECK_CLOSE(histogram.GetAverage(), 500.5, 0.01);
+	BOOST_CHECK_CLOSE(histogram.GetMax(), 1000, 0.01);
+	BOOST_CHECK_CLOSE(histogram.GetPercentile(50), 500, 6.25);
+	BOOST_CHECK_CLOSE(histogram.GetPercentile(90), 900, 6.25);
+	BOOST_CHECK_CLOSE(histogram.GetPercentile(99), 990, 6.25);
+	BOOST_CHECK(histogram.GetPercentile(100) <= histogram.GetMax());
+
+	TimeHistogram merged(histogram);
+	merged.Merge(histogram);
+	BOOST_CHECK(merged.GetCount() == 2000);
+	BOOST_CHECK_CLOSE(merged.GetPercentile(50), 500, 6.25);
+}
+
+BOOST_AUTO_TEST_CASE(PhaseTest) {
+	Phase phase("TimeHistogramTest");
+	BOOST_CHECK(Phase("TimeHistogramTest").GetId() == phase.GetId());
+	BOOST_CHECK(Phase::Find("TimeHistogramTest") == phase.GetId());
+	BOOST_CHECK(Phase::GetName(phase.GetId()) == "TimeHistogramTest");
+	BOOST_CHECK(Phase("").IsNone());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}	// namespace test
+
+}	// namespace ea
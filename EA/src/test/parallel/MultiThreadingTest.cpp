@@ -10,6 +10,7 @@
 
 #include "../../EA.h"
 #include <unistd.h>
+#include <thread>
 
 namespace ea {
 namespace test {
@@ -34,6 +35,26 @@ BOOST_AUTO_TEST_CASE(NumThreadsTest) {
 	BOOST_CHECK(population.GetRealNumThreads() == cores);
 }
 
+BOOST_AUTO_TEST_CASE(ThreadStatsTest) {
+	const uint threads = 4, loops = 10000;
+	auto stats = MultiThreading::GetThreadStats();
+	ullong before = stats.empty() ? 0 : stats[0].loops;
+
+	// Loops started from several threads all run with thread number 0, no count is lost
+	vector<thread> callers;
+	for (uint t = 0; t < threads; t++)
+		callers.emplace_back([] {
+			for (uint i = 0; i < loops; i++)
+				MultiThreading::For(0, 4, [] (int) { });
+		});
+	for (auto& caller : callers)
+		caller.join();
+
+	stats = MultiThreading::GetThreadStats();
+	BOOST_REQUIRE(!stats.empty());
+	BOOST_CHECK(stats[0].loops == before + threads * loops);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }}
@@ -0,0 +1,67 @@
+/*
+ * RecordStoreTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../../EA.h"
+#include "../../misc/RecordStore.h"
+#include <thread>
+
+namespace ea {
+namespace test {
+
+BOOST_AUTO_TEST_SUITE(RecordStoreTest)
+
+BOOST_AUTO_TEST_CASE(AppendTest) {
+	RecordStore<ullong> store;
+	BOOST_CHECK(store.GetSize() == 0);
+
+	for (ullong i = 0; i < 10000; i++)
+		store.Append(i * 3);
+	BOOST_REQUIRE(store.GetSize() == 10000);
+
+	bool correct = true;
+	for (ullong i = 0; i < 10000; i++)
+		correct &= store[i] == i * 3;
+	BOOST_CHECK(correct);
+
+	store.Clear();
+	BOOST_CHECK(store.GetSize() == 0);
+	store.Append(7);
+	BOOST_CHECK(store.GetSize() == 1 && store[0] == 7);
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentReadTest) {
+	const ullong size = 200000;
+	RecordStore<ullong> store;
+
+	// Readers check every published record while the writer is appending
+	atomic<bool> correct(true);
+	vector<thread> readers;
+	for (uint t = 0; t < 2; t++)
+		readers.emplace_back([&] {
+			ullong checked = 0;
+			while (checked < size) {
+				ullong published = store.GetSize();
+				for (; checked < published; checked++)
+					if (store[checked] != checked + 1)
+						correct = false;
+			}
+		});
+
+	for (ullong i = 0; i < size; i++)
+		store.Append(i + 1);
+
+	for (auto& reader : readers)
+		reader.join();
+	BOOST_CHECK(correct);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}}
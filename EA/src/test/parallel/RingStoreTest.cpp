@@ -0,0 +1,80 @@
+/*
+ * RingStoreTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../../EA.h"
+#include "../../misc/RingStore.h"
+#include <thread>
+
+namespace ea {
+namespace test {
+
+BOOST_AUTO_TEST_SUITE(RingStoreTest)
+
+BOOST_AUTO_TEST_CASE(CapacityTest) {
+	RingStore<ullong> store(100);
+	BOOST_CHECK(store.GetSize() == 0 && store.GetCapacity() == 100);
+
+	ullong record;
+	for (ullong i = 0; i < 50; i++)
+		store.Append(i);
+	BOOST_CHECK(store.GetBegin() == 0);
+	BOOST_CHECK(store.Get(49, record) && record == 49);
+	BOOST_CHECK(!store.Get(50, record));
+
+	for (ullong i = 50; i < 1000; i++)
+		store.Append(i);
+	BOOST_REQUIRE(store.GetSize() == 1000);
+	BOOST_CHECK(store.GetBegin() == 900);
+
+	bool correct = true;
+	for (ullong i = 0; i < 1000; i++)
+		correct &= store.Get(i, record) == (i >= 900) && (i < 900 || record == i);
+	BOOST_CHECK(correct);
+
+	store.Clear();
+	BOOST_CHECK(store.GetSize() == 0 && store.GetBegin() == 0);
+	store.Append(7);
+	BOOST_CHECK(store.Get(0, record) && record == 7);
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentReadTest) {
+	const ullong size = 200000;
+	struct Record {
+		ullong index, check;
+	};
+
+	// Readers check every published record while the writer is appending,
+	// the removed records must be rejected and not read partially
+	RingStore<Record> store(50);
+	atomic<bool> correct(true);
+	vector<thread> readers;
+	for (uint t = 0; t < 2; t++)
+		readers.emplace_back([&] {
+			ullong checked = 0;
+			Record record;
+			while (checked < size) {
+				ullong published = store.GetSize();
+				for (checked = max(checked, store.GetBegin()); checked < published; checked++)
+					if (store.Get(checked, record) && (record.index != checked || record.check != ~checked))
+						correct = false;
+			}
+		});
+
+	for (ullong i = 0; i < size; i++)
+		store.Append({ i, ~i });
+
+	for (auto& reader : readers)
+		reader.join();
+	BOOST_CHECK(correct);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}}
@@ -21,18 +21,19 @@ struct PermMutationFixture {
 	~PermMutationFixture() {
 	}
 
-	bool Run(uint genomeLength) {
+	bool Run(uint genomeLength, uint count = 1) {
 		vector<uint> p1genes(genomeLength);
 		iota(p1genes.begin(), p1genes.end(), 0);
 		shuffle(p1genes.begin(), p1genes.end(), Random::generator);
 
-		GenomePtr p1 = make_shared<PermutationGenome>(p1genes);
+		PermutationGenomePtr p1 = make_shared<PermutationGenome>(p1genes);
 
 		//
-		MutatorPtr mutator = make_shared_base(Mutator, T);
+		MutatorPtr mutator = make_shared_base(Mutator, T, count);
 		PermutationGenomePtr child = dynamic_pointer_cast<PermutationGenome>(mutator->Apply(p1));
 
-		return child->IsValid();
+		// The target must not be modified
+		return child->IsValid() && child->GetSize() == genomeLength && p1->GetGenes() == p1genes;
 	}
 };
 
@@ -42,21 +43,29 @@ BOOST_FIXTURE_TEST_CASE(InsertMutationTest, PermMutationFixture<InsertMutation>)
 	BOOST_CHECK_THROW(Run(1), EAException);
 	BOOST_CHECK_EQUAL(Run(2), true);
 	BOOST_CHECK_EQUAL(Run(12345), true);
+	BOOST_CHECK_EQUAL(Run(3, 5), true);
+	BOOST_CHECK_EQUAL(Run(12345, 5), true);
 }
 BOOST_FIXTURE_TEST_CASE(InversionMutationTest, PermMutationFixture<InversionMutation>) {
 	BOOST_CHECK_THROW(Run(1), EAException);
 	BOOST_CHECK_EQUAL(Run(2), true);
 	BOOST_CHECK_EQUAL(Run(8971), true);
+	BOOST_CHECK_EQUAL(Run(3, 5), true);
+	BOOST_CHECK_EQUAL(Run(8971, 5), true);
 }
 BOOST_FIXTURE_TEST_CASE(ScrambleMutationTest, PermMutationFixture<ScrambleMutation>) {
 	BOOST_CHECK_THROW(Run(1), EAException);
 	BOOST_CHECK_EQUAL(Run(2), true);
 	BOOST_CHECK_EQUAL(Run(9977), true);
+	BOOST_CHECK_EQUAL(Run(3, 5), true);
+	BOOST_CHECK_EQUAL(Run(9977, 5), true);
 }
 BOOST_FIXTURE_TEST_CASE(SwapMutationTest, PermMutationFixture<SwapMutation>) {
 	BOOST_CHECK_THROW(Run(1), EAException);
 	BOOST_CHECK_EQUAL(Run(2), true);
 	BOOST_CHECK_EQUAL(Run(11987), true);
+	BOOST_CHECK_EQUAL(Run(3, 5), true);
+	BOOST_CHECK_EQUAL(Run(11987, 5), true);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
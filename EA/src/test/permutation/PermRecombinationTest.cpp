@@ -62,6 +62,29 @@ BOOST_FIXTURE_TEST_CASE(EdgeCrossoverTest, PermRecombinationFixture<EdgeCrossove
 	BOOST_CHECK_EQUAL(Run(2, 2), true);
 	BOOST_CHECK_EQUAL(Run(897, 897), true);
 }
+BOOST_AUTO_TEST_CASE(EdgeCrossoverEdgesTest) {
+	// With identical parents, every edge is common so the child only uses edges of the parents
+	vector<uint> genes(5000);
+	iota(genes.begin(), genes.end(), 0);
+	shuffle(genes.begin(), genes.end(), Random::generator);
+
+	vector<uint> positions(genes.size());
+	for (uint i = 0; i < genes.size(); i++)
+		positions[genes[i]] = i;
+
+	vector<GenomePtr> parents = { make_shared<PermutationGenome>(genes), make_shared<PermutationGenome>(genes) };
+	RecombinatorPtr recomb = make_shared_base(Recombinator, EdgeCrossover);
+	PermutationGenomePtr child = dynamic_pointer_cast<PermutationGenome>(recomb->Combine(parents));
+	BOOST_REQUIRE(child->IsValid());
+
+	auto& childGenes = child->GetGenes();
+	bool adjacent = true;
+	for (uint i = 0; i + 1 < childGenes.size(); i++) {
+		uint distance = (positions[childGenes[i]] + genes.size() - positions[childGenes[i + 1]]) % genes.size();
+		adjacent = adjacent && (distance == 1 || distance == genes.size() - 1);
+	}
+	BOOST_CHECK(adjacent);
+}
 BOOST_FIXTURE_TEST_CASE(OrderCrossoverTest, PermRecombinationFixture<OrderCrossover>) {
 	BOOST_CHECK_THROW(Run(0, 0), EAException);
 	BOOST_CHECK_THROW(Run(2, 3), EAException);
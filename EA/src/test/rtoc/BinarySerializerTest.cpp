@@ -98,6 +98,40 @@ BOOST_AUTO_TEST_CASE(VectorTest) {
 					+ 9) * 100 + 4);
 }
 
+BOOST_AUTO_TEST_CASE(BulkVectorTest) {
+	vector<double> data(1000);
+	for (uint i = 0; i < data.size(); i++)
+		data[i] = i * 0.5;
+
+	ostringstream os;
+	BinarySerializer<vector<double>>::Write(os, data);
+	BOOST_CHECK(os.str().size() == data.size() * sizeof(double) + 4);
+
+	istringstream is(os.str());
+	BOOST_CHECK(BinarySerializer<vector<double>>::Read(is) == data);
+}
+
+BOOST_AUTO_TEST_CASE(TypeDictionaryTest) {
+	Ptr<TestGenome> genome = make_shared<TestGenome>();
+	genome->mValue = 20;
+	vector<GenomePtr> genomes(100, genome);
+
+	ostringstream os;
+	{
+		TypeDictionary dict(os);
+		BinarySerializer<vector<GenomePtr>>::Write(os, genomes);
+		BOOST_CHECK(dict.GetSize() == 1);
+	}
+	BOOST_CHECK(TypeDictionary::Get(os) == nullptr);
+	BOOST_CHECK(os.str().size() == genome->GetTypeName().length() + 1 + 5 * 100 + 4);
+
+	istringstream is(os.str());
+	TypeDictionary dict(is);
+	auto genomes_copy = BinarySerializer<vector<GenomePtr>>::Read(is);
+	BOOST_CHECK(genomes_copy.size() == 100);
+	BOOST_CHECK(static_pointer_cast<TestGenome>(genomes_copy.back())->mValue == 20);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
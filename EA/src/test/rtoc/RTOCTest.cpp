@@ -91,6 +91,16 @@ BOOST_FIXTURE_TEST_CASE(ConstructTest, ConstructibleFixture) {
 	BOOST_CHECK(masterObj->GetServant() == servant1);
 }
 
+BOOST_AUTO_TEST_CASE(DefaultFactoryTest) {
+	const TypeInfo& fitness = NameService::Get("ScalarFitness");
+	BOOST_REQUIRE(fitness.GetDefaultFactory());
+	BOOST_CHECK(dynamic_pointer_cast<ScalarFitness>(fitness.ConstructDefault()));
+
+	const TypeInfo& hook = NameService::Get("GenerationTerminationHook");
+	BOOST_CHECK(!hook.GetDefaultFactory());
+	BOOST_CHECK_THROW(hook.ConstructDefault(), RTOCException);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_FIXTURE_TEST_CASE(NameServiceTest, ConstructibleFixture) {
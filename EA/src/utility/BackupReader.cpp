@@ -0,0 +1,262 @@
+/*
+ * BackupReader.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../pch.h"
+#include "BackupReader.h"
+#include "../hook/BackupHook.h"
+#include "../core/Population.h"
+#include "../core/pool/OrganismPool.h"
+#include "../core/pool/GenomePool.h"
+#include "../rtoc/BinarySerializer.h"
+#include "../misc/MultiThreading.h"
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
+
+namespace ea {
+
+/**
+ * @class BackupReader
+ * Random-access reader of indexed back-ups.
+ * This class reads back-up files written by BackupHook with the indexed option (see BackupIndex).
+ * When created from a file, the file is memory-mapped and only the index is decoded,
+ * Pool and Organism are decoded on demand. Large Pool are decoded in parallel (see MultiThreading).
+ *
+ * @code
+ * BackupReader reader("backup/000100.eabak");
+ * OrganismPoolPtr best = reader.ReadTop(0, 10);
+ * @endcode
+ *
+ * Restore uses this class automatically for indexed back-ups.
+ *
+ * @see BackupHook
+ * @see Restore
+ */
+
+#ifndef DOXYGEN_IGNORE
+using ArrayStream = boost::iostreams::stream<boost::iostreams::array_source>;
+
+static const uint CHUNK_SIZE = 64;
+#endif
+
+/**
+ * Open an indexed back-up file.
+ * The file is memory-mapped and stays mapped until the reader is destroyed.
+ * @param pFilename The path of the back-up file.
+ */
+BackupReader::BackupReader(string pFilename) :
+		mFile(), mStream(nullptr), mStart(0), mData(nullptr), mSize(0), mCounters(), mCheckpoint(), mTypes(), mPools() {
+	try {
+		mFile.open(pFilename);
+	} catch (exception& e) {
+		throw EA_EXCEPTION(EAException, FILE_DOES_NOT_EXIST,
+				"BackupReader: Cannot open \"" + pFilename + "\".", current_exception());
+	}
+
+	ArrayStream stream(mFile.data(), mFile.size());
+	Load(stream);
+	mData = mFile.data() + streamoff(mStart);
+}
+
+/**
+ * Read an indexed back-up from a stream.
+ * The stream must be seekable and stay valid until the reader is destroyed.
+ * Elements are decoded sequentially from the stream.
+ * @param pStream The input stream, positioned at the beginning of the back-up.
+ */
+BackupReader::BackupReader(istream& pStream) :
+		mFile(), mStream(&pStream), mStart(0), mData(nullptr), mSize(0), mCounters(), mCheckpoint(), mTypes(), mPools() {
+	Load(pStream);
+}
+
+BackupReader::~BackupReader() {
+}
+
+void BackupReader::Load(istream& pStream) {
+	BackupHook::Header header = BackupHook::ReadHeader(pStream);
+	if (header.kind != BackupHook::INDEXED_BACKUP)
+		throw EA_EXCEPTION(EAException, FILE_FEATURE_NOT_SUPPORT,
+				"BackupReader: The back-up is not indexed.");
+	mCheckpoint = header.checkpoint;
+
+	mStart = pStream.tellg();
+	BinarySerializer<map<string, ullong>>::Read(pStream, mCounters);
+
+	pStream.seekg(-streamoff(sizeof(ullong)), ios::end);
+	mSize = BinarySerializer<ullong>::Read(pStream);
+	pStream.seekg(mStart + streamoff(mSize));
+
+	for (const string& name : BinarySerializer<vector<string>>::Read(pStream))
+		mTypes.push_back(&NameService::Get(name));
+
+	uint poolCount = BinarySerializer<uint>::Read(pStream);
+	for (uint i = 0; i < poolCount; i++) {
+		BackupIndex::PoolEntry entry;
+		entry.index = BinarySerializer<uint>::Read(pStream);
+		entry.mode = BackupIndex::PoolMode(BinarySerializer<unsigned char>::Read(pStream));
+		BinarySerializer<vector<ullong>>::Read(pStream, entry.offsets);
+		BinarySerializer<vector<uint>>::Read(pStream, entry.ranks);
+		mPools.emplace(entry.index, move(entry));
+	}
+
+	if (!pStream)
+		throw EA_EXCEPTION(EAException, WRONG_FILE_FORMAT,
+				"BackupReader: The index of the back-up is corrupted.");
+}
+
+/**
+ * Get the value of a counter stored in the back-up.
+ * @param pId The string used to identify the counter.
+ * @return The value of the counter.
+ */
+ullong BackupReader::GetCounter(string pId) const {
+	auto itr = mCounters.find(pId);
+	if (itr == mCounters.end())
+		throw EA_EXCEPTION(EAException, ID_DOES_NOT_EXIST,
+				"BackupReader: Counter \"" + pId + "\" does not exist.");
+	return itr->second;
+}
+
+/**
+ * Get the generation number stored in the back-up.
+ * @return The generation number.
+ */
+ullong BackupReader::GetGeneration() const {
+	return GetCounter(Population::GENERATION_COUNTER);
+}
+
+/**
+ * Get the evaluation number stored in the back-up.
+ * @return The evaluation number.
+ */
+ullong BackupReader::GetEvaluation() const {
+	return GetCounter(Population::EVALUATION_COUNTER);
+}
+
+/**
+ * Get the indices of all Pool stored in the back-up.
+ * @return The list of indices.
+ */
+vector<uint> BackupReader::GetPoolIndices() const {
+	vector<uint> indices;
+	for (auto& entry : mPools)
+		indices.push_back(entry.first);
+	return indices;
+}
+
+/**
+ * Get the number of elements of a Pool without decoding it.
+ * @param pIndex The index of the Pool.
+ * @return The number of Organism or Genome in the Pool (0 if the Pool is empty or of another kind).
+ */
+uint BackupReader::GetPoolSize(uint pIndex) const {
+	const BackupIndex::PoolEntry& entry = GetEntry(pIndex);
+	if (entry.mode == BackupIndex::ORGANISM_POOL || entry.mode == BackupIndex::GENOME_POOL)
+		return entry.offsets.size() - 1;
+	return 0;
+}
+
+/**
+ * Decode the whole Population.
+ * The checkpoint record of the back-up is attached to the Population (see Population::GetCheckpoint()).
+ * @return The restored Population.
+ */
+PopulationPtr BackupReader::ReadPopulation() const {
+	PopulationPtr population = make_shared<Population>();
+	for (auto& counter : mCounters)
+		population->SetCounter(counter.first, counter.second);
+	for (auto& entry : mPools)
+		population->SetPool(entry.first, ReadPool(entry.first));
+	population->SetCheckpoint(mCheckpoint);
+	return population;
+}
+
+/**
+ * Decode a single Pool.
+ * @param pIndex The index of the Pool.
+ * @return The decoded Pool (nullptr if the Pool was empty).
+ */
+PoolPtr BackupReader::ReadPool(uint pIndex) const {
+	const BackupIndex::PoolEntry& entry = GetEntry(pIndex);
+
+	vector<uint> positions(GetPoolSize(pIndex));
+	for (uint i = 0; i < positions.size(); i++)
+		positions[i] = i;
+
+	switch (entry.mode) {
+	case BackupIndex::ORGANISM_POOL: {
+		auto organisms = ReadElements<OrganismPtr>(entry, positions);
+		return make_shared<OrganismPool>(organisms.begin(), organisms.end());
+	}
+	case BackupIndex::GENOME_POOL: {
+		auto genomes = ReadElements<GenomePtr>(entry, positions);
+		return make_shared<GenomePool>(genomes.begin(), genomes.end());
+	}
+	case BackupIndex::FULL_POOL:
+		return ReadElements<PoolPtr>(entry, { 0 })[0];
+	default:
+		return nullptr;
+	}
+}
+
+/**
+ * Decode the best Organism of an OrganismPool.
+ * Only the requested Organism are decoded.
+ * If the fitness of some Organism was missing when the back-up was written, the first Organism are returned.
+ * @param pIndex The index of the OrganismPool.
+ * @param pCount The number of Organism to be decoded.
+ * @return An OrganismPool containing the best Organism, from the best to the worst.
+ */
+OrganismPoolPtr BackupReader::ReadTop(uint pIndex, uint pCount) const {
+	const BackupIndex::PoolEntry& entry = GetEntry(pIndex);
+	if (entry.mode != BackupIndex::ORGANISM_POOL)
+		throw EA_EXCEPTION(EAException, POOL_BAD_CAST,
+				"BackupReader: Pool #" + to_string(pIndex) + " is not an OrganismPool.");
+
+	vector<uint> positions(min(pCount, GetPoolSize(pIndex)));
+	for (uint i = 0; i < positions.size(); i++)
+		positions[i] = entry.ranks.empty() ? i : entry.ranks[i];
+
+	auto organisms = ReadElements<OrganismPtr>(entry, positions);
+	return make_shared<OrganismPool>(organisms.begin(), organisms.end());
+}
+
+const BackupIndex::PoolEntry& BackupReader::GetEntry(uint pIndex) const {
+	auto itr = mPools.find(pIndex);
+	if (itr == mPools.end())
+		throw EA_EXCEPTION(EAException, ID_DOES_NOT_EXIST,
+				"BackupReader: Pool #" + to_string(pIndex) + " does not exist.");
+	return itr->second;
+}
+
+template<class T>
+vector<T> BackupReader::ReadElements(const BackupIndex::PoolEntry& pEntry, const vector<uint>& pPositions) const {
+	vector<T> elements(pPositions.size());
+
+	if (mStream) {
+		TypeDictionary dict(*mStream, mTypes);
+		for (uint i = 0; i < pPositions.size(); i++) {
+			mStream->seekg(mStart + streamoff(pEntry.offsets[pPositions[i]]));
+			elements[i] = BinarySerializer<T>::Read(*mStream);
+		}
+		return elements;
+	}
+
+	uint chunks = (pPositions.size() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+	MultiThreading::For(0, chunks, [&](int chunk) {
+		ArrayStream stream(mData, mSize);
+		TypeDictionary dict(stream, mTypes);
+
+		uint end = min<uint>((chunk + 1) * CHUNK_SIZE, pPositions.size());
+		for (uint i = chunk * CHUNK_SIZE; i < end; i++) {
+			stream.seekg(pEntry.offsets[pPositions[i]]);
+			elements[i] = BinarySerializer<T>::Read(stream);
+		}
+	});
+	return elements;
+}
+
+} /* namespace ea */
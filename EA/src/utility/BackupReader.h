@@ -0,0 +1,58 @@
+/*
+ * BackupReader.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../EA/Type/Core.h"
+#include "../hook/BackupIndex.h"
+#include "../rtoc/TypeInfo.h"
+#include <boost/iostreams/device/mapped_file.hpp>
+
+namespace ea {
+
+using namespace std;
+
+class BackupReader {
+public:
+	BackupReader(string pFilename);
+	BackupReader(istream& pStream);
+	~BackupReader();
+
+	BackupReader(const BackupReader&) = delete;
+	BackupReader& operator=(const BackupReader&) = delete;
+
+	ullong GetCounter(string pId) const;
+	ullong GetGeneration() const;
+	ullong GetEvaluation() const;
+
+	vector<uint> GetPoolIndices() const;
+	uint GetPoolSize(uint pIndex) const;
+
+	PopulationPtr ReadPopulation() const;
+	PoolPtr ReadPool(uint pIndex) const;
+	OrganismPoolPtr ReadTop(uint pIndex, uint pCount) const;
+
+private:
+	boost::iostreams::mapped_file_source mFile;
+	istream* mStream;
+	streampos mStart;
+	const char* mData;
+	ullong mSize;
+
+	map<string, ullong> mCounters;
+	CheckpointPoolPtr mCheckpoint;
+	vector<const TypeInfo*> mTypes;
+	map<uint, BackupIndex::PoolEntry> mPools;
+
+	void Load(istream& pStream);
+	const BackupIndex::PoolEntry& GetEntry(uint pIndex) const;
+
+	template<class T>
+	vector<T> ReadElements(const BackupIndex::PoolEntry& pEntry, const vector<uint>& pPositions) const;
+};
+
+} /* namespace ea */
@@ -0,0 +1,102 @@
+/*
+ * Checkpoint.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../pch.h"
+#include "Checkpoint.h"
+#include "../core/Population.h"
+#include "../core/pool/CheckpointPool.h"
+#include "../core/interface/Checkpointable.h"
+#include "../core/interface/Strategy.h"
+#include "../misc/Random.h"
+
+namespace ea {
+
+/**
+ * @class Checkpoint
+ * A static class which saves and reinstates the state needed for bit-exact resumable runs.
+ * Besides the Pool and counters, a run depends on the state of Random::generator and on the internal state
+ * of some components (see Checkpointable). Capture() stores these states in a CheckpointPool,
+ * which BackupHook writes as a separate record of the back-up file (the evolving Population is not modified).
+ * Restore attaches the record to the restored Population (see Population::GetCheckpoint())
+ * and Reinstate() gives the states back to Random and to the components of the Strategy.
+ *
+ * BackupHook captures the state before each back-up, and Strategy::Evolve() reinstates it
+ * when a restored Population is given. With a single thread, resuming from generation k then yields
+ * the same results as the uninterrupted run (operators running in parallel share the generator,
+ * so their order of draws is not reproducible).
+ *
+ * @see Checkpointable
+ * @see CheckpointPool
+ */
+
+#ifndef DOXYGEN_IGNORE
+static const string RANDOM_KEY = "Random";
+
+static string ComponentKey(uint pIndex) {
+	return "Component#" + to_string(pIndex);
+}
+#endif
+
+/**
+ * Capture the state of Random and of all Checkpointable components of the Strategy.
+ * @param pStrategy The Strategy whose components are captured (can be nullptr).
+ * @return The captured state.
+ */
+CheckpointPoolPtr Checkpoint::Capture(const StrategyPtr& pStrategy) {
+	CheckpointPoolPtr pool = make_shared<CheckpointPool>();
+
+	ostringstream random;
+	Random::SaveState(random);
+	(*pool)[RANDOM_KEY] = random.str();
+
+	if (pStrategy) {
+		auto components = pStrategy->GetCheckpointables();
+		for (uint i = 0; i < components.size(); i++) {
+			ostringstream state;
+			components[i]->SaveState(state);
+			(*pool)[ComponentKey(i)] = state.str();
+		}
+	}
+
+	return pool;
+}
+
+/**
+ * Reinstate the state captured by Capture().
+ * Components which have no saved state are left unchanged.
+ * @param pPopulation The restored Population.
+ * @param pStrategy The Strategy whose components are reinstated (can be nullptr).
+ * @return false if the Population has no captured state.
+ */
+bool Checkpoint::Reinstate(const PopulationPtr& pPopulation, const StrategyPtr& pStrategy) {
+	CheckpointPoolPtr pool = pPopulation->GetCheckpoint();
+	if (!pool)
+		return false;
+
+	auto random = pool->find(RANDOM_KEY);
+	if (random != pool->end()) {
+		istringstream iss(random->second);
+		Random::LoadState(iss);
+	}
+
+	if (pStrategy) {
+		auto components = pStrategy->GetCheckpointables();
+		for (uint i = 0; i < components.size(); i++) {
+			auto state = pool->find(ComponentKey(i));
+			if (state == pool->end())
+				continue;
+			istringstream iss(state->second);
+			components[i]->LoadState(iss);
+		}
+	}
+
+	EA_LOG_DEBUG << "Checkpoint::Reinstate: Random generator and " << (pool->size() - 1)
+			<< " component state(s) reinstated." << flush;
+	return true;
+}
+
+} /* namespace ea */
@@ -0,0 +1,22 @@
+/*
+ * Checkpoint.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../EA/Type/Core.h"
+
+namespace ea {
+
+using namespace std;
+
+class Checkpoint {
+public:
+	static CheckpointPoolPtr Capture(const StrategyPtr& pStrategy);
+	static bool Reinstate(const PopulationPtr& pPopulation, const StrategyPtr& pStrategy);
+};
+
+} /* namespace ea */
@@ -0,0 +1,137 @@
+/*
+ * FitnessHistoryReader.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#include "../pch.h"
+#include "FitnessHistoryReader.h"
+#include "../hook/FitnessReportHook.h"
+#include "../hook/BackupHook.h"
+#include "../hook/BackupCodec.h"
+#include "../rtoc/BinarySerializer.h"
+
+namespace ea {
+
+/**
+ * @class FitnessHistoryReader
+ * Sequential reader of binary fitness reports.
+ * This class reads the files written by FitnessReportHook in the binary format, row by row,
+ * so the history of long runs can be processed without loading it entirely.
+ *
+ * @code
+ * FitnessHistoryReader reader("fitness.eafh");
+ * FitnessHistoryReader::Row row;
+ * while (reader.Next(row))
+ *     cout << row.generation << " " << *max_element(row.values.begin(), row.values.end()) << endl;
+ * @endcode
+ *
+ * WriteCSV() converts the whole file into the CSV format of FitnessReportHook.
+ *
+ * @see FitnessReportHook
+ */
+
+/**
+ * Open a binary fitness report.
+ * @param pFileName The path of the file.
+ */
+FitnessHistoryReader::FitnessHistoryReader(string pFileName) :
+		mFile(pFileName, ios_base::in | ios_base::binary), mStream(), mCodec(), mSummary(false) {
+	if (!mFile)
+		throw EA_EXCEPTION(EAException, FILE_DOES_NOT_EXIST,
+				"FitnessHistoryReader: Cannot open \"" + pFileName + "\".");
+
+	char magic[sizeof(FitnessReportHook::sMagic)];
+	mFile.read(magic, sizeof(magic));
+	if (!mFile || !equal(magic, magic + sizeof(magic), FitnessReportHook::sMagic))
+		throw EA_EXCEPTION(EAException, WRONG_FILE_FORMAT,
+				"FitnessHistoryReader: \"" + pFileName + "\" is not a binary fitness report.");
+
+	uint version = BinarySerializer<uint>::Read(mFile);
+	if (version > FitnessReportHook::sVersion)
+		throw EA_EXCEPTION(EAException, FILE_FEATURE_NOT_SUPPORT,
+				"FitnessHistoryReader: Format version " + to_string(version) + " is not supported.");
+
+	if (BinarySerializer<uint>::Read(mFile) != BackupHook::sByteOrder)
+		throw EA_EXCEPTION(EAException, FILE_FEATURE_NOT_SUPPORT,
+				"FitnessHistoryReader: File was written on a machine with different byte order.");
+
+	mCodec = BinarySerializer<string>::Read(mFile);
+	mSummary = BinarySerializer<bool>::Read(mFile);
+
+	BackupCodec::Get(mCodec)->PushDecoder(mStream);
+	mStream.push(mFile, 1 << 16);
+}
+
+FitnessHistoryReader::~FitnessHistoryReader() {
+}
+
+/**
+ * Whether the rows contain summary statistics.
+ * If true, the values of each row are the minimum, maximum, mean and standard deviation of the fitness values.
+ * @return true if the file was written in summary mode.
+ */
+bool FitnessHistoryReader::IsSummary() const {
+	return mSummary;
+}
+
+/**
+ * Get the name of the BackupCodec the file was written with.
+ * @return The codec name.
+ */
+const string& FitnessHistoryReader::GetCodec() const {
+	return mCodec;
+}
+
+/**
+ * Read the next row of the file.
+ * The vector of values in pRow is reused, so calling this function in a loop does not reallocate.
+ * @param pRow The row to be filled.
+ * @return false if the end of the file is reached.
+ */
+bool FitnessHistoryReader::Next(Row& pRow) {
+	if (mStream.peek() == EOF)
+		return false;
+
+	pRow.generation = BinarySerializer<ullong>::Read(mStream);
+	pRow.size = BinarySerializer<uint>::Read(mStream);
+	BinarySerializer<vector<double>>::Read(mStream, pRow.values);
+
+	if (!mStream)
+		throw EA_EXCEPTION(EAException, WRONG_FILE_FORMAT,
+				"FitnessHistoryReader::Next: The file is truncated.");
+	return true;
+}
+
+/**
+ * Read all remaining rows of the file.
+ * @return The list of rows.
+ */
+vector<FitnessHistoryReader::Row> FitnessHistoryReader::ReadAll() {
+	vector<Row> rows;
+	Row row;
+	while (Next(row))
+		rows.push_back(row);
+	return rows;
+}
+
+/**
+ * Write all remaining rows to a stream in the CSV format of FitnessReportHook.
+ * @param pStream The output stream.
+ */
+void FitnessHistoryReader::WriteCSV(ostream& pStream) {
+	auto precision = pStream.precision(17);
+	Row row;
+	while (Next(row)) {
+		pStream << row.generation;
+		if (mSummary)
+			pStream << ',' << row.size;
+		for (double value : row.values)
+			pStream << ',' << value;
+		pStream << '\n';
+	}
+	pStream.precision(precision);
+}
+
+} /* namespace ea */
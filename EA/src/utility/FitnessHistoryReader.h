@@ -0,0 +1,46 @@
+/*
+ * FitnessHistoryReader.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: OpenEA contributors
+ */
+
+#pragma once
+
+#include "../Common.h"
+#include <fstream>
+#include <boost/iostreams/filtering_stream.hpp>
+
+namespace ea {
+
+using namespace std;
+
+class FitnessHistoryReader {
+public:
+	struct Row {
+		ullong generation;		///< The generation number of the row.
+		uint size;				///< The size of the main pool at that generation.
+		vector<double> values;	///< The fitness values, or the summary statistics.
+	};
+
+	FitnessHistoryReader(string pFileName);
+	~FitnessHistoryReader();
+
+	FitnessHistoryReader(const FitnessHistoryReader&) = delete;
+	FitnessHistoryReader& operator=(const FitnessHistoryReader&) = delete;
+
+	bool IsSummary() const;
+	const string& GetCodec() const;
+
+	bool Next(Row& pRow);
+	vector<Row> ReadAll();
+	void WriteCSV(ostream& pStream);
+
+private:
+	ifstream mFile;
+	boost::iostreams::filtering_istream mStream;
+	string mCodec;
+	bool mSummary;
+};
+
+} /* namespace ea */
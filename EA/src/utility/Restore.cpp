@@ -12,6 +12,10 @@
 #include "../hook/BackupHook.h"
 #include "../rtoc/BinarySerializer.h"
 #include "../core/Population.h"
+#include "../rtoc/TypeDictionary.h"
+#include "../hook/BackupCodec.h"
+#include "../hook/BackupDelta.h"
+#include "BackupReader.h"
 
 namespace ea {
 
@@ -21,6 +25,8 @@ namespace ea {
  * This class is used to restore a Population has been backed up by BackupHook.
  * The generation and evaluation number is also restored from the back-up file.
  * The restored Population includes the fitness evaluated in the previous run.
+ * Incremental back-ups (see BackupDelta) are restored by replaying the chain from the last full back-up.
+ * Indexed back-ups are memory-mapped and decoded in parallel by BackupReader.
  */
 
 /**
@@ -67,8 +73,7 @@ PopulationPtr Restore::FromBackup(string pLocation, ullong pFrom) {
 				"Restore::FromBackup: \"" + pLocation
 						+ "\" is not a regular file or does not contain any backup file.");
 
-	std::ifstream ifs(p.string(), ios::binary);
-	PopulationPtr population = BinarySerializer<PopulationPtr>::Read(ifs);
+	PopulationPtr population = FromFile(p.string());
 
 	EA_LOG_DEBUG << "Restore::FromBackup: Population restored from \"" << p.string()
 			<< "\", gen " << population->GetGeneration() << ", evl " << population->GetEvaluation() << flush;
@@ -76,4 +81,66 @@ PopulationPtr Restore::FromBackup(string pLocation, ullong pFrom) {
 	return population;
 }
 
+/**
+ * Restore the Population from a stream written by BackupHook.
+ * Both the current format (with header, TypeDictionary and BackupCodec) and the legacy format (without header) are accepted.
+ * The stream must be seekable so the header can be detected.
+ * If the stream contains a delta, the base Population is obtained from pBaseLoader.
+ * The checkpoint record of the back-up is attached to the restored Population (see Population::GetCheckpoint()).
+ *
+ * @param pStream The input stream.
+ * @param pBaseLoader A function which restores the Population of a given generation,
+ * required to restore incremental back-ups.
+ * @return The restored Population.
+ */
+PopulationPtr Restore::FromStream(istream& pStream, function<PopulationPtr(ullong)> pBaseLoader) {
+	auto start = pStream.tellg();
+	BackupHook::Header header = BackupHook::ReadHeader(pStream);
+	if (header.version == 0)
+		return BinarySerializer<PopulationPtr>::Read(pStream);
+
+	if (header.kind == BackupHook::INDEXED_BACKUP) {
+		pStream.seekg(start);
+		return BackupReader(pStream).ReadPopulation();
+	}
+
+	PopulationPtr base;
+	if (header.kind == BackupHook::DELTA_BACKUP) {
+		if (!pBaseLoader)
+			throw EA_EXCEPTION(EAException, FILE_FEATURE_NOT_SUPPORT,
+					"Restore::FromStream: Backup is a delta but no base can be loaded.");
+		base = pBaseLoader(header.base);
+	}
+
+	boost::iostreams::filtering_istream filter;
+	BackupCodec::Get(header.codec)->PushDecoder(filter);
+	bool direct = filter.empty();
+	if (!direct)
+		filter.push(pStream);
+
+	istream& in = direct ? pStream : filter;
+	TypeDictionary dict(in);
+	PopulationPtr population = base ? BackupDelta::Read(in, base) : BinarySerializer<PopulationPtr>::Read(in);
+	population->SetCheckpoint(header.checkpoint);
+	return population;
+}
+
+PopulationPtr Restore::FromFile(string pFilename) {
+	using namespace boost::filesystem;
+
+	path dir = path(pFilename).parent_path();
+	std::ifstream ifs(pFilename, ios::binary);
+	if (!ifs)
+		throw EA_EXCEPTION(EAException, FILE_DOES_NOT_EXIST,
+				"Restore::FromFile: Cannot open \"" + pFilename + "\".");
+
+	if (BackupHook::ReadHeader(ifs).kind == BackupHook::INDEXED_BACKUP)
+		return BackupReader(pFilename).ReadPopulation();
+	ifs.seekg(0);
+
+	return FromStream(ifs, [dir](ullong pGeneration) {
+		return FromFile((dir / (boost::format("%06llu.eabak") % pGeneration).str()).string());
+	});
+}
+
 } /* namespace ea */
@@ -17,6 +17,10 @@ namespace ea {
 class Restore {
 public:
 	static PopulationPtr FromBackup(string pLocation, ullong pFrom = UINT64_MAX);
+	static PopulationPtr FromStream(istream& pStream, function<PopulationPtr(ullong)> pBaseLoader = nullptr);
+
+private:
+	static PopulationPtr FromFile(string pFilename);
 };
 
 } /* namespace ea */